@@ -24,7 +24,7 @@
 #define AMD_SHADOWFX_H
 
 #    define AMD_SHADOWFX_VERSION_MAJOR            2
-#    define AMD_SHADOWFX_VERSION_MINOR            0
+#    define AMD_SHADOWFX_VERSION_MINOR            1
 #    define AMD_SHADOWFX_VERSION_PATCH            0
 
 #    ifdef AMD_SHADOWFX_COMPILE_STATIC_LIB
@@ -38,6 +38,7 @@
 #    endif // AMD_COMPILE_STATIC
 
 #    include "AMD_Types.h"
+#    include "AMD_ShadowFX_Capture.h"
 
 #   if defined(DEBUG) || defined(_DEBUG)
 #       define AMD_SHADOWFX_DEBUG                 1
@@ -62,6 +63,7 @@ typedef enum SHADOWFX_RETURN_CODE_t
     SHADOWFX_RETURN_CODE_INVALID_POINTER,
     SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED,
     SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED,
+    SHADOWFX_RETURN_CODE_NOT_READY,
 
     SHADOWFX_RETURN_CODE_COUNT,
 } SHADOWFX_RETURN_CODE;
@@ -105,7 +107,8 @@ typedef enum SHADOWFX_TEXTURE_TYPE_t
 {
     SHADOWFX_TEXTURE_2D                          = 0,
     SHADOWFX_TEXTURE_2D_ARRAY                    = 1,
-    SHADOWFX_TEXTURE_TYPE_COUNT                  = 2,
+    SHADOWFX_TEXTURE_2D_VIRTUAL                  = 2, // physical page atlas addressed through a page table (DX11 only)
+    SHADOWFX_TEXTURE_TYPE_COUNT                  = 3,
 } SHADOWFX_TEXTURE_TYPE;
 
 // The TAP types
@@ -113,7 +116,8 @@ typedef enum SHADOWFX_TAP_TYPE_t
 {
     SHADOWFX_TAP_TYPE_FIXED                      = 0,
     SHADOWFX_TAP_TYPE_POISSON                    = 1,
-    SHADOWFX_TAP_TYPE_COUNT                      = 2,
+    SHADOWFX_TAP_TYPE_POISSON_ROTATED            = 2, // 12 poisson taps rotated per pixel, followed by a 5x5 denoise of the mask (DX11 only)
+    SHADOWFX_TAP_TYPE_COUNT                      = 3,
 } SHADOWFX_TAP_TYPE;
 
 typedef enum SHADOWFX_NORMAL_OPTION_t
@@ -145,6 +149,21 @@ typedef enum SHADOWFX_OUTPUT_CHANNEL_t
 
 struct ShadowFX_OpaqueDesc;
 
+/**
+Optional hooks into the application CPU profiler.
+m_pBegin is called when the library enters a zone and m_pEnd when it leaves it, on the thread calling the library.
+Zones are properly nested and their names are string literals that remain valid for the lifetime of the process
+*/
+typedef void (*ShadowFX_ProfileBegin)(const char * name, void * pUserData);
+typedef void (*ShadowFX_ProfileEnd)(void * pUserData);
+
+struct ShadowFX_Profiler
+{
+    ShadowFX_ProfileBegin                        m_pBegin; // [required] called when a zone is entered
+    ShadowFX_ProfileEnd                          m_pEnd; // [required] called when the last entered zone is left
+    void*                                        m_pUserData; // [optional] passed back to both callbacks
+};
+
 struct ShadowFX_Desc
 {
     /**
@@ -159,6 +178,7 @@ struct ShadowFX_Desc
 #pragma warning(pop)
 
     static const uint                            m_MaxLightCount = 6; // this has to be at least 6 to allow cube map shadow maps to work
+    static const uint                            m_StatsLatency = 4; // DX12: ShadowFX_GetStats can report the GPU time of a call up to this many calls old on the same instance
 
 #if defined(AMD_SHADOWFX_D3D12)
     ID3D12Device*                                m_pDevice; // [required]
@@ -168,7 +188,7 @@ struct ShadowFX_Desc
     ID3D11DeviceContext*                         m_pContext; // required
 #endif
 
-    bool                                         m_EnableCapture; // [optional]
+    bool                                         m_EnableCapture; // [optional] append a record of each ShadowFX_Render call to m_pCaptureFile, see AMD_ShadowFX_Capture.h
 
     Camera                                       m_Viewer; // [required] Optional at initialization
     float2                                       m_DepthSize; // [required] Viewer Depth Buffer Size. Optional at initialization
@@ -239,6 +259,25 @@ struct ShadowFX_Desc
     */
     ShadowFX_OpaqueDesc*                         m_pOpaque;
 
+    /**
+    Members added in version 2.1. They follow m_pOpaque so the members above keep their 2.0 layout
+    */
+    const char*                                  m_pCaptureFile; // [optional] required if m_EnableCapture is set
+    uint                                         m_CaptureFlags; // [optional] SHADOWFX_CAPTURE textures written with each captured call. Only used in DX11
+    bool                                         m_EnableStats; // [optional] time the filtering passes on the GPU, see ShadowFX_GetStats
+    ShadowFX_Profiler*                           m_pProfiler; // [optional] CPU profiler hooks, no profiling if NULL
+
+    bool                                         m_ShadowWrap[m_MaxLightCount]; // [optional] sample the array slice with wrap addressing
+
+#if defined(AMD_SHADOWFX_D3D12)
+    ID3D12CommandQueue*                          m_pCommandQueue; // [optional] queue executing m_CommandList. Only used by ShadowFX_GetStats to convert GPU timestamps
+    ID3D12Fence*                                 m_pStatsFence; // [optional] fence signaled once m_CommandList has executed. Only used by ShadowFX_GetStats
+    UINT64                                       m_StatsFenceValue; // [optional] value m_pStatsFence reaches once m_CommandList has executed, 0 if unknown
+#else
+    ID3D11ShaderResourceView*                    m_pPageTableSRV; // [optional] virtual shadow map page table (Texture2D<uint>). Only used with SHADOWFX_TEXTURE_2D_VIRTUAL
+    ID3D11UnorderedAccessView*                   m_pFeedbackUAV; // [optional] virtual shadow map page requests (RWTexture2D<uint>). Only used by ShadowFX_RenderFeedback
+#endif
+
 private:
     /**
     Copy constructor and assign operator are declared but lack implementation.
@@ -248,6 +287,47 @@ private:
     AMD_SHADOWFX_DLL_API                         ShadowFX_Desc & operator= (const ShadowFX_Desc &);
 };
 
+/**
+Depth bounds of the visible pixels written by ShadowFX_GetDepthBounds and ShadowFX_ReduceDepthBoundsCPU.
+They let the application fit cascade splits and light projections to the receivers actually on screen.
+A bound is empty (min greater than max) when no visible pixel contributed to it
+*/
+struct ShadowFX_DepthBounds
+{
+    float                                        m_MinDepth; // closest view space distance of a visible pixel
+    float                                        m_MaxDepth; // farthest view space distance of a visible pixel
+    ShadowFX_Desc::float3                        m_ReceiverMin[ShadowFX_Desc::m_MaxLightCount]; // per light: min shadow map uv (.xy) and depth (.z) of the visible pixels it shadows
+    ShadowFX_Desc::float3                        m_ReceiverMax[ShadowFX_Desc::m_MaxLightCount]; // per light: max shadow map uv (.xy) and depth (.z) of the visible pixels it shadows
+};
+
+/**
+Statistics of the ShadowFX_Render calls written by ShadowFX_GetStats.
+The counters are updated by every call. The GPU time is only measured while m_EnableStats is set and it is read back
+without stalling, so it belongs to an older call: m_GpuTimeRenderIndex identifies that call and the permutation members
+describe the shader it used
+*/
+struct ShadowFX_Stats
+{
+    uint                                         m_RenderCount; // ShadowFX_Render calls since ShadowFX_Initialize
+    uint                                         m_ShaderCreateCount; // shaders created by ShadowFX_Initialize (DX11)
+    uint                                         m_PipelineCreateCount; // pipeline states created on the first use of a permutation (DX12)
+    uint                                         m_ResourceCreateCount; // internal textures (re)created while rendering, e.g. the rotated poisson mask (DX11)
+    uint                                         m_ConstantBufferUploadCount; // constant buffer updates
+    uint64                                       m_ConstantBufferUploadBytes; // bytes written to constant buffers
+
+    uint                                         m_GpuTimeRenderIndex; // 1 based index of the timed call in m_RenderCount, 0 while no GPU time is available
+    float                                        m_GpuTime; // milliseconds spent by the GPU in the passes of the timed call
+    uint                                         m_GpuPassCount; // fullscreen passes of the timed call (2 with the rotated poisson denoise)
+
+    SHADOWFX_EXECUTION                           m_Execution; // permutation of the timed call
+    SHADOWFX_TEXTURE_TYPE                        m_TextureType;
+    SHADOWFX_TEXTURE_FETCH                       m_TextureFetch;
+    SHADOWFX_FILTERING                           m_Filtering;
+    SHADOWFX_TAP_TYPE                            m_TapType;
+    SHADOWFX_FILTER_SIZE                         m_FilterSize;
+    SHADOWFX_NORMAL_OPTION                       m_NormalOption;
+};
+
 extern "C"
 {
     /**
@@ -282,6 +362,9 @@ extern "C"
         ** m_NormalOffsetScale[] - a scalar that is used to displace tested position in world space before projecting to light space.
                                    It used when Normal option is set to either CALC_FROM_DEPTH or READ_FROM_SRV
         ** m_ArraySlice[] - texture array index. It is used when m_TextureType is equal to ARRAY
+        ** m_ShadowWrap[] - false by default. Only used when m_TextureType is equal to ARRAY. Set it for a toroidally addressed
+                            (clipmap) slice: the slice is sampled with wrap addressing and m_ShadowRegion[] may extend past 1
+                            (see gu::shadow_clipmap). Lights that don't set it keep clamp addressing
     Optionally application can change:
     * m_Execution - lights can be arranged either:
         ** as a union of shadow casters (each shadowed pixel is tested against each shadow caster)
@@ -289,9 +372,14 @@ extern "C"
         ** as a cube map light (each shadowed pixel selects the correct shadow cube face and only uses that for filtering)
     * m_Implementation - alternate between compute shader and pixel shader implementations (CS is under development)
     * m_TextureType - shadow map(s) can be stored in either a texture 2d (atlas) or a texture 2d array
+                      VIRTUAL reads a physical page atlas through m_pPageTableSRV. m_ShadowRegion[] is then expressed in the virtual uv space
+                      and m_ShadowSize[] in virtual mip 0 texels. Only used in DX11
     * m_TextureFetch - alternate between shader permutations that use Gather 4 or PCF instructions
     * m_Filtering - alternate between uniform and contact hardening shadows;
     * m_TapType - alternate between sampling all texels inside the filtering kernel or fetch poisson distributed samples (less samples)
+                  POISSON_ROTATED fetches 12 poisson samples rotated per pixel with interleaved gradient noise.
+                  The noisy mask is written to an internal target and an edge aware 5x5 filter resolves it into m_pOutputRTV.
+                  Only used in DX11. DX12 returns SHADOWFX_RETURN_CODE_INVALID_ARGUMENT
     * m_FilterSize - select filter size from 7x7 to 15x15
     * m_NormalOption - each visible pixel on the screen is first reprojected in World Space. At this point it can be displaced along the normal
                        to help reduce incorrect self shadowing. Normal can either be calculated from depth buffer or fetched from SRV
@@ -312,9 +400,65 @@ extern "C"
     * m_MaxInstance maximum number of instances: Up to m_MaxInstance shadow masks can be created in parallel. Only used in DX12
     * m_InstanceID instance id must be less than m_MaxInstance. Only used in DX12
     * m_PreserveViewport the library will not change the viewport and scissor if set to true. The default is false and the library sets viewport and scissor
+    * m_pProfiler - set to valid profiler hooks to time the CPU side of the call (constant buffer update, shader permutation lookup, pass submission)
+    * m_EnableStats - surround the passes with GPU timestamps so ShadowFX_GetStats can report their cost. This must be set at initialization
+    * m_EnableCapture - append the parameters of the call to m_pCaptureFile (opened on the first capture and kept open until ShadowFX_Release or
+                        until m_pCaptureFile names another file). The records are buffered and reach the file when the buffer fills up,
+                        on the next call made with m_EnableCapture cleared, when m_pCaptureFile changes or in ShadowFX_Release.
+                        The streams are re-executed by amd_shadowfx/tools/replay
+    * m_CaptureFlags - also write the textures of the captured call: their mip 0 is copied to a staging texture and read back,
+                       which stalls until the GPU has executed the call. Only used in DX11, DX12 captures the parameters only
+    * m_pCommandQueue - queue executing m_CommandList, used to convert GPU timestamps when m_EnableStats is set. Only used in DX12
+    * m_StatsFenceValue - value m_pStatsFence reaches once m_CommandList has executed. ShadowFX_GetStats only reads the GPU time
+                          of the call once m_pStatsFence has reached it, a call made with 0 is never read. Only used in DX12
     */
     AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_Render         (const ShadowFX_Desc & desc);
 
+    /**
+    Write the virtual shadow map pages required by the current view
+    Calling this function requires the same parameters as ShadowFX_Render with m_TextureType set to SHADOWFX_TEXTURE_2D_VIRTUAL and:
+    * m_pFeedbackUAV must be set to a valid R32_UINT unordered access view with one texel per mip 0 page.
+      It is cleared to 0xffffffff and each requested page receives the finest mip sampled by a visible pixel.
+      The application reads it back (usually a few frames later) and passes it to its page allocator
+    Only implemented in DX11. DX12 returns SHADOWFX_RETURN_CODE_INVALID_ARGUMENT
+    */
+    AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_RenderFeedback (const ShadowFX_Desc & desc);
+
+    /**
+    Reduce the view depth range of the visible pixels and the receiver bounds of each light
+    Calling this function requires the same parameters as ShadowFX_Render, the output and shadow map views are not used.
+    Pixels with a depth of 1 are treated as background and skipped. Receivers are assigned to lights with the same rules
+    as the filtering (m_Execution) but without the normal offset.
+    The result is copied to a readback ring and is available through ShadowFX_GetDepthBounds one frame later
+    Only implemented in DX11. DX12 returns SHADOWFX_RETURN_CODE_INVALID_ARGUMENT
+    */
+    AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_ReduceDepthBounds (const ShadowFX_Desc & desc);
+
+    /**
+    Read the oldest depth bounds reduction that the GPU has completed. It never stalls:
+    SHADOWFX_RETURN_CODE_NOT_READY is returned when the oldest pending reduction is still in flight or none is pending
+    Only implemented in DX11. DX12 returns SHADOWFX_RETURN_CODE_INVALID_ARGUMENT
+    */
+    AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_GetDepthBounds (const ShadowFX_Desc & desc, ShadowFX_DepthBounds * pBounds);
+
+    /**
+    CPU reference of ShadowFX_ReduceDepthBounds used to verify the GPU reduction
+    * pDepth points to m_DepthSize.x * m_DepthSize.y depth values, rows are rowPitch bytes apart
+    Only m_Viewer, m_DepthSize, m_Light[], m_ActiveLightCount and m_Execution are used, ShadowFX_Initialize is not required.
+    DX11 and DX12 share the implementation, so it also verifies reductions made by the application in DX12
+    */
+    AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_ReduceDepthBoundsCPU (const ShadowFX_Desc & desc, const float * pDepth, uint rowPitch, ShadowFX_DepthBounds * pBounds);
+
+    /**
+    Read the statistics of the ShadowFX_Render calls. It never stalls.
+    The counters are always written. SHADOWFX_RETURN_CODE_NOT_READY is returned while no GPU time is available, either because
+    m_EnableStats was not set at initialization or because no timed call has completed yet.
+    In DX11 the most recent call the GPU has completed is reported, usually a couple of frames old.
+    In DX12 the most recent of the last m_StatsLatency + 1 calls with the same m_InstanceID whose m_StatsFenceValue
+    m_pStatsFence has reached is reported. m_pCommandQueue and m_pStatsFence must be set
+    */
+    AMD_SHADOWFX_DLL_API SHADOWFX_RETURN_CODE ShadowFX_GetStats       (const ShadowFX_Desc & desc, ShadowFX_Stats * pStats);
+
     /**
     Release all internal data used by ShadowFX_OpaqueDesc
     */
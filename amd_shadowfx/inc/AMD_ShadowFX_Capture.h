@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_SHADOWFX_CAPTURE_H
+#define AMD_SHADOWFX_CAPTURE_H
+
+// This header only depends on AMD_Types.h so captures can be read on any platform (see amd_shadowfx/tools/replay)
+#include "AMD_Types.h"
+
+namespace AMD
+{
+// Textures written with a captured call (ShadowFX_Desc::m_CaptureFlags)
+typedef enum SHADOWFX_CAPTURE_t
+{
+    SHADOWFX_CAPTURE_DEPTH                       = 1, // viewer depth buffer
+    SHADOWFX_CAPTURE_NORMAL                      = 2, // viewer normals, only with SHADOWFX_NORMAL_OPTION_READ_FROM_SRV
+    SHADOWFX_CAPTURE_SHADOW                      = 4, // shadow map, every slice of a texture array
+    SHADOWFX_CAPTURE_OUTPUT                      = 8, // shadow mask written by the call: the reference a replay is compared to
+    SHADOWFX_CAPTURE_ALL                         = 15,
+} SHADOWFX_CAPTURE;
+
+typedef enum SHADOWFX_CAPTURE_API_t
+{
+    SHADOWFX_CAPTURE_API_D3D11                   = 11,
+    SHADOWFX_CAPTURE_API_D3D12                   = 12,
+} SHADOWFX_CAPTURE_API;
+
+static const uint                                SHADOWFX_CAPTURE_MAGIC = 0x43584653; // "SFXC"
+// version history of ShadowFX_CaptureCall. A version only appends members, so a reader fills the ones missing from an
+// older call with 0 (see SHADOWFX_CAPTURE_CALL_SIZE)
+// 1: first version
+// 2: m_ShadowWrap
+static const uint                                SHADOWFX_CAPTURE_VERSION = 2;
+static const uint                                SHADOWFX_CAPTURE_MAX_LIGHT_COUNT = 6; // ShadowFX_Desc::m_MaxLightCount
+
+/**
+A capture stream is a sequence of calls, each appended by a ShadowFX_Render call made while m_EnableCapture was set.
+A call is a ShadowFX_CaptureCall followed by m_TextureCount textures, each a ShadowFX_CaptureTexture immediately
+followed by its m_DataSize bytes of texels. Every value is 32 bits and little endian, and m_Size lets a reader skip
+a call it doesn't understand. m_Magic, m_Version and m_Size start the call in every version and m_Version tells which
+members follow them.
+The enums hold the SHADOWFX_* values of ShadowFX_Desc and the formats hold DXGI_FORMAT values
+*/
+struct ShadowFX_CaptureCall
+{
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4201)        // suppress nameless struct/union level 4 warnings
+#endif
+    AMD_DECLARE_BASIC_VECTOR_TYPE;
+    AMD_DECLARE_CAMERA_TYPE;
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+    uint                                         m_Magic; // SHADOWFX_CAPTURE_MAGIC
+    uint                                         m_Version; // SHADOWFX_CAPTURE_VERSION
+    uint                                         m_Size; // bytes of the call, textures included
+    uint                                         m_Api; // SHADOWFX_CAPTURE_API of the library that captured the call
+    uint                                         m_RenderIndex; // 1 based ShadowFX_Render call index since ShadowFX_Initialize
+    uint                                         m_InstanceID; // DX12 instance, 0 in DX11
+    uint                                         m_TextureCount;
+
+    uint                                         m_Execution;
+    uint                                         m_Implementation;
+    uint                                         m_TextureType;
+    uint                                         m_TextureFetch;
+    uint                                         m_Filtering;
+    uint                                         m_TapType;
+    uint                                         m_FilterSize;
+    uint                                         m_NormalOption;
+    uint                                         m_OutputFormat;
+    uint                                         m_OutputChannels; // DX11 only, 0 when the application set m_pOutputBS
+    uint                                         m_ActiveLightCount;
+
+    Camera                                       m_Viewer;
+    float2                                       m_DepthSize;
+
+    Camera                                       m_Light[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float2                                       m_ShadowSize[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float4                                       m_ShadowRegion[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float                                        m_SunArea[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float                                        m_DepthTestOffset[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float                                        m_NormalOffsetScale[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    float                                        m_Weight[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    uint                                         m_ArraySlice[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT];
+    uint                                         m_ShadowWrap[SHADOWFX_CAPTURE_MAX_LIGHT_COUNT]; // 0 or 1 (version 2)
+};
+
+// bytes of the ShadowFX_CaptureCall of each version, textures excluded. Index 0 is unused
+static const uint                                SHADOWFX_CAPTURE_CALL_SIZE[SHADOWFX_CAPTURE_VERSION + 1] =
+{
+    0,
+    sizeof(ShadowFX_CaptureCall) - SHADOWFX_CAPTURE_MAX_LIGHT_COUNT * sizeof(uint),
+    sizeof(ShadowFX_CaptureCall),
+};
+
+struct ShadowFX_CaptureTexture
+{
+    uint                                         m_Usage; // a single SHADOWFX_CAPTURE flag
+    uint                                         m_Format; // format of the view the library reads or writes
+    uint                                         m_Width;
+    uint                                         m_Height;
+    uint                                         m_ArraySize;
+    uint                                         m_RowPitch; // bytes of a row, rows and slices are tightly packed
+    uint                                         m_DataSize; // m_RowPitch * m_Height * m_ArraySize
+};
+
+}
+
+#endif // AMD_SHADOWFX_CAPTURE_H
@@ -47,8 +47,11 @@ project ("AMD_" .. _AMD_LIBRARY_NAME .. "11")
    -- Specify WindowsTargetPlatformVersion here for VS2015
    systemversion (_AMD_WIN_SDK_VERSION)
 
-   files { "../inc/**.h", "../src/AMD_%{_AMD_LIBRARY_NAME}_Precompiled.h", "../src/AMD_%{_AMD_LIBRARY_NAME}11*.h", "../src/AMD_%{_AMD_LIBRARY_NAME}11*.cpp", "../src/Shaders/**.hlsl" }
+   files { "../inc/**.h", "../src/AMD_%{_AMD_LIBRARY_NAME}_*.h", "../src/AMD_%{_AMD_LIBRARY_NAME}11*.h", "../src/AMD_%{_AMD_LIBRARY_NAME}11*.cpp", "../src/Shaders/**.hlsl" }
    includedirs { "../inc", "../../amd_lib/shared/common/inc", "../../amd_lib/shared/%{_AMD_D3D_VERSION}/inc" }
+   -- Generate the precompiled shader headers that are not in ../src/Shaders/inc yet
+   prebuildcommands { "call ..\\src\\Shaders\\build\\fxc_compile_missing.bat" }
+   prebuildmessage "Generating missing precompiled shaders..."
    links { "AMD_LIB" }
 
    filter "configurations:DLL_*"
@@ -33,6 +33,8 @@
 #endif
 
 #include "AMD_ShadowFX11_Opaque.h"
+#include "AMD_ShadowFX_Profile.h"
+#include "AMD_ShadowFX_DepthBounds.h"
 
 #pragma warning( disable : 4996 )// disable stdio deprecated
 
@@ -40,6 +42,10 @@ namespace AMD
 {
     ShadowFX_Desc::ShadowFX_Desc()
         : m_EnableCapture(false)
+        , m_pCaptureFile(NULL)
+        , m_CaptureFlags(0)
+        , m_EnableStats(false)
+        , m_pProfiler(NULL)
         , m_TextureType(SHADOWFX_TEXTURE_2D)
         , m_Filtering(SHADOWFX_FILTERING_DEBUG_POINT)
         , m_TextureFetch(SHADOWFX_TEXTURE_FETCH_PCF)
@@ -55,6 +61,8 @@ namespace AMD
         , m_pShadowSRV(NULL)
         , m_pNormalSRV(NULL)
         , m_pOutputRTV(NULL)
+        , m_pPageTableSRV(NULL)
+        , m_pFeedbackUAV(NULL)
         , m_pOutputBS(NULL)
         , m_pOutputDSV(NULL)
         , m_OutputChannels(0xf)
@@ -62,6 +70,11 @@ namespace AMD
         , m_ReferenceDSS(0)
         , m_ActiveLightCount(0)
     {
+        for (uint i = 0; i < m_MaxLightCount; i++)
+        {
+            m_ShadowWrap[i] = false;
+        }
+
         static ShadowFX_OpaqueDesc opaque(*this);
         m_pOpaque = &opaque;
     }
@@ -87,7 +100,10 @@ namespace AMD
             return SHADOWFX_RETURN_CODE_INVALID_DEVICE;
         }
 
-        SHADOWFX_RETURN_CODE result = desc.m_pOpaque->cbInitialize(desc);
+        SHADOWFX_RETURN_CODE result = desc.m_pOpaque->createStats(desc);
+        if (result != SHADOWFX_RETURN_CODE_SUCCESS)
+            return result;
+        result = desc.m_pOpaque->cbInitialize(desc);
         if (result != SHADOWFX_RETURN_CODE_SUCCESS) 
             return result;
         result = desc.m_pOpaque->createShaders(desc);
@@ -109,6 +125,8 @@ namespace AMD
             return SHADOWFX_RETURN_CODE_INVALID_DEVICE_CONTEXT;
         }
 
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX_Render");
+
         AMD::C_SaveRestore_IA save_ia(desc.m_pContext);
         AMD::C_SaveRestore_VS save_vs(desc.m_pContext);
         AMD::C_SaveRestore_HS save_hs(desc.m_pContext);
@@ -121,9 +139,96 @@ namespace AMD
 
         SHADOWFX_RETURN_CODE result = desc.m_pOpaque->render(desc);
 
+        if (result == SHADOWFX_RETURN_CODE_SUCCESS && desc.m_EnableCapture)
+        {
+            SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX capture");
+            result = desc.m_pOpaque->capture(desc);
+        }
+        else if (result == SHADOWFX_RETURN_CODE_SUCCESS)
+        {
+            // the first call made after a capture writes its buffered records
+            result = desc.m_pOpaque->flushCapture();
+        }
+
         return result;
     }
 
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_RenderFeedback(const ShadowFX_Desc & desc)
+    {
+        if (NULL == desc.m_pContext)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_DEVICE_CONTEXT;
+        }
+
+        AMD::C_SaveRestore_IA save_ia(desc.m_pContext);
+        AMD::C_SaveRestore_VS save_vs(desc.m_pContext);
+        AMD::C_SaveRestore_HS save_hs(desc.m_pContext);
+        AMD::C_SaveRestore_DS save_ds(desc.m_pContext);
+        AMD::C_SaveRestore_GS save_gs(desc.m_pContext);
+        AMD::C_SaveRestore_PS save_ps(desc.m_pContext);
+        AMD::C_SaveRestore_RS save_rs(desc.m_pContext);
+        AMD::C_SaveRestore_OM save_om(desc.m_pContext);
+        AMD::C_SaveRestore_CS save_cs(desc.m_pContext);
+
+        SHADOWFX_RETURN_CODE result = desc.m_pOpaque->renderFeedback(desc);
+
+        return result;
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_ReduceDepthBounds(const ShadowFX_Desc & desc)
+    {
+        if (NULL == desc.m_pContext)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_DEVICE_CONTEXT;
+        }
+
+        AMD::C_SaveRestore_CS save_cs(desc.m_pContext);
+
+        SHADOWFX_RETURN_CODE result = desc.m_pOpaque->reduceDepthBounds(desc);
+
+        return result;
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_GetDepthBounds(const ShadowFX_Desc & desc, ShadowFX_DepthBounds * pBounds)
+    {
+        if (NULL == desc.m_pContext)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_DEVICE_CONTEXT;
+        }
+
+        if (NULL == pBounds)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_POINTER;
+        }
+
+        return desc.m_pOpaque->getDepthBounds(desc, *pBounds);
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_ReduceDepthBoundsCPU(const ShadowFX_Desc & desc, const float * pDepth, uint rowPitch, ShadowFX_DepthBounds * pBounds)
+    {
+        if (NULL == pDepth || NULL == pBounds)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_POINTER;
+        }
+
+        return ShadowFX_ReduceDepthBoundsReference(desc, pDepth, rowPitch, *pBounds);
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_GetStats(const ShadowFX_Desc & desc, ShadowFX_Stats * pStats)
+    {
+        if (NULL == desc.m_pContext)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_DEVICE_CONTEXT;
+        }
+
+        if (NULL == pStats)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_POINTER;
+        }
+
+        return desc.m_pOpaque->getStats(desc, *pStats);
+    }
+
 }
 
 
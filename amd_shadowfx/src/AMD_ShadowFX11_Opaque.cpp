@@ -23,6 +23,9 @@
 #include <d3d11.h>
 #include <string>
 #include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cfloat>
 
 #define _USE_MATH_DEFINES
 #include <cmath>
@@ -35,6 +38,8 @@
 
 #include "AMD_ShadowFX11_Opaque.h"
 #include "AMD_ShadowFX_Precompiled.h"
+#include "AMD_ShadowFX_Profile.h"
+#include "AMD_ShadowFX_DepthBounds.h"
 
 #pragma warning( disable : 4100 ) // disable unreference formal parameter warnings for /W4 builds
 
@@ -47,11 +52,33 @@ ShadowFX_OpaqueDesc::ShadowFX_OpaqueDesc(const ShadowFX_Desc & desc)
     , m_scsLinearBorder(NULL)
     , m_scsPointClamp(NULL)
     , m_scsLinearClamp(NULL)
+    , m_ssPointWrap(NULL)
+    , m_ssLinearWrap(NULL)
+    , m_scsPointWrap(NULL)
+    , m_scsLinearWrap(NULL)
     , m_vsFullscreen(NULL)
     , m_cbShadowsData(NULL)
     , m_rsNoCulling(NULL)
     , m_dssEqualToRef(NULL)
+    , m_psShadowDenoise(NULL)
+    , m_t2dShadowMask(NULL)
+    , m_srvShadowMask(NULL)
+    , m_rtvShadowMask(NULL)
+    , m_bufDepthBounds(NULL)
+    , m_uavDepthBounds(NULL)
+    , m_DepthBoundsWrite(0)
+    , m_DepthBoundsPending(0)
+    , m_StatsWrite(0)
+    , m_StatsPending(0)
+    , m_pCaptureFile(NULL)
+    , m_CapturePending(false)
 {
+    m_ShadowMaskSize.x = 0.0f;
+    m_ShadowMaskSize.y = 0.0f;
+
+    memset(m_StatsQuery, 0, sizeof(m_StatsQuery));
+    memset(&m_Stats, 0, sizeof(m_Stats));
+
     for (int execution = 0; execution < SHADOWFX_EXECUTION_COUNT; execution++)
     {
         for (int filter = 0; filter < SHADOWFX_FILTERING_COUNT; filter++)
@@ -66,6 +93,7 @@ ShadowFX_OpaqueDesc::ShadowFX_OpaqueDesc(const ShadowFX_Desc & desc)
                         {
                             m_psShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize] = NULL;
                             m_psShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize] = NULL;
+                            m_psShadowT2DV[filter][execution][textureFetch][tapType][normalOption][filterSize] = NULL;
                         }
                     }
                 }
@@ -76,14 +104,23 @@ ShadowFX_OpaqueDesc::ShadowFX_OpaqueDesc(const ShadowFX_Desc & desc)
         {
             m_psShadowPointDebugT2D[execution][normalOption] = NULL;
             m_psShadowPointDebugT2DA[execution][normalOption] = NULL;
+            m_psShadowPointDebugT2DV[execution][normalOption] = NULL;
         }
 
+        m_psShadowFeedback[execution] = NULL;
+        m_csDepthBounds[execution] = NULL;
+
     }
 
     for (int i = 0; i < SHADOWFX_OUTPUT_CHANNEL_COUNT; i++)
     {
         m_bsOutputChannel[i] = NULL;
     }
+
+    for (uint i = 0; i < m_DepthBoundsRingSize; i++)
+    {
+        m_bufDepthBoundsReadback[i] = NULL;
+    }
 }
 
 ShadowFX_OpaqueDesc::~ShadowFX_OpaqueDesc()
@@ -138,6 +175,28 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::cbInitialize(const ShadowFX_Desc & des
     hr = (desc.m_pDevice->CreateSamplerState(&ssDesc, &m_scsLinearBorder));
     if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
 
+    // clipmap cascades filter across the toroidal seam of their texture array slice
+    ssDesc.AddressU = D3D11_TEXTURE_ADDRESS_WRAP;
+    ssDesc.AddressV = D3D11_TEXTURE_ADDRESS_WRAP;
+    ssDesc.AddressW = D3D11_TEXTURE_ADDRESS_WRAP;
+    ssDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_POINT;
+    ssDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+    hr = (desc.m_pDevice->CreateSamplerState(&ssDesc, &m_ssPointWrap));
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    ssDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    hr = (desc.m_pDevice->CreateSamplerState(&ssDesc, &m_ssLinearWrap));
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    ssDesc.Filter = D3D11_FILTER_COMPARISON_MIN_MAG_MIP_POINT;
+    ssDesc.ComparisonFunc = D3D11_COMPARISON_LESS_EQUAL;
+    hr = (desc.m_pDevice->CreateSamplerState(&ssDesc, &m_scsPointWrap));
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    ssDesc.Filter = D3D11_FILTER_COMPARISON_MIN_MAG_LINEAR_MIP_POINT;
+    hr = (desc.m_pDevice->CreateSamplerState(&ssDesc, &m_scsLinearWrap));
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
     CD3D11_BLEND_DESC bsDesc(d3d11Default);
     m_bsOutputChannel[0] = NULL;
     for (int blend = SHADOWFX_OUTPUT_CHANNEL_R; blend < SHADOWFX_OUTPUT_CHANNEL_COUNT; blend++)
@@ -189,18 +248,43 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createShaders(const ShadowFX_Desc & de
                     {
                         for (int filterSize = 0; filterSize < SHADOWFX_FILTER_SIZE_COUNT; filterSize++)
                         {
+                            // the rotated permutations have their own arrays, PS_SF_T2D_Data stops at PS_SF_TAP_TYPE_COUNT
+                            if (tapType == SHADOWFX_TAP_TYPE_POISSON_ROTATED)
+                            {
+                                int idx = filterSize;
+                                idx += normalOption * SHADOWFX_FILTER_SIZE_COUNT;
+                                idx += textureFetch * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT;
+                                idx += execution * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT;
+                                idx += filter * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT * SHADOWFX_EXECUTION_COUNT;
+
+                                hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2D_ROTATED_Data[idx], PS_SF_T2D_ROTATED_Size[idx], NULL, &m_psShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize]);
+                                if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+                                m_Stats.m_ShaderCreateCount++;
+
+                                hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2DA_ROTATED_Data[idx], PS_SF_T2DA_ROTATED_Size[idx], NULL, &m_psShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize]);
+                                if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+                                m_Stats.m_ShaderCreateCount++;
+                                continue;
+                            }
+
                             int idx = filterSize;
                             idx += normalOption * SHADOWFX_FILTER_SIZE_COUNT;
                             idx += tapType * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT;
-                            idx += textureFetch * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT;
-                            idx += execution * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT;
-                            idx += filter * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT * SHADOWFX_EXECUTION_COUNT;
+                            idx += textureFetch * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT;
+                            idx += execution * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT;
+                            idx += filter * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT * SHADOWFX_EXECUTION_COUNT;
 
                             hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2D_Data[idx], PS_SF_T2D_Size[idx], NULL, &m_psShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize]);
                             if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+                            m_Stats.m_ShaderCreateCount++;
 
                             hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2DA_Data[idx], PS_SF_T2DA_Size[idx], NULL, &m_psShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize]);
                             if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+                            m_Stats.m_ShaderCreateCount++;
+
+                            hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2DV_Data[idx], PS_SF_T2DV_Size[idx], NULL, &m_psShadowT2DV[filter][execution][textureFetch][tapType][normalOption][filterSize]);
+                            if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+                            m_Stats.m_ShaderCreateCount++;
                         }
                     }
                 }
@@ -217,14 +301,63 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createShaders(const ShadowFX_Desc & de
             idx += execution * SHADOWFX_NORMAL_OPTION_COUNT;
             hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2D_POINT_Data[idx], PS_SF_T2D_POINT_Size[idx], NULL, &m_psShadowPointDebugT2D[execution][normalOption]);
             if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+            m_Stats.m_ShaderCreateCount++;
 
             hr  = desc.m_pDevice->CreatePixelShader(PS_SF_T2DA_POINT_Data[idx], PS_SF_T2DA_POINT_Size[idx], NULL, &m_psShadowPointDebugT2DA[execution][normalOption]);
             if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+            m_Stats.m_ShaderCreateCount++;
+
+            hr = desc.m_pDevice->CreatePixelShader(PS_SF_T2DV_POINT_Data[idx], PS_SF_T2DV_POINT_Size[idx], NULL, &m_psShadowPointDebugT2DV[execution][normalOption]);
+            if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+            m_Stats.m_ShaderCreateCount++;
         }
+
+        hr = desc.m_pDevice->CreatePixelShader(PS_SF_EXEC_FEEDBACK_Data[execution], PS_SF_EXEC_FEEDBACK_Size[execution], NULL, &m_psShadowFeedback[execution]);
+        if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+        m_Stats.m_ShaderCreateCount++;
+
+        hr = desc.m_pDevice->CreateComputeShader(CS_SF_EXEC_DEPTH_BOUNDS_Data[execution], CS_SF_EXEC_DEPTH_BOUNDS_Size[execution], NULL, &m_csDepthBounds[execution]);
+        if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+        m_Stats.m_ShaderCreateCount++;
     }
 
+    hr = desc.m_pDevice->CreatePixelShader(PS_SF_DENOISE_Data, sizeof(PS_SF_DENOISE_Data), NULL, &m_psShadowDenoise);
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+    m_Stats.m_ShaderCreateCount++;
+
     hr = desc.m_pDevice->CreateVertexShader(VS_FULLSCREEN_Data, sizeof(VS_FULLSCREEN_Data), NULL, &m_vsFullscreen);
     if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+    m_Stats.m_ShaderCreateCount++;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createShadowMask(const ShadowFX_Desc & desc)
+{
+    if (m_t2dShadowMask != NULL &&
+        m_ShadowMaskSize.x == desc.m_DepthSize.x &&
+        m_ShadowMaskSize.y == desc.m_DepthSize.y)
+    {
+        return SHADOWFX_RETURN_CODE_SUCCESS;
+    }
+
+    releaseShadowMask();
+
+    // the device is taken from the context, render() may be called with only the context set
+    ID3D11Device* pDevice = NULL;
+    desc.m_pContext->GetDevice(&pDevice);
+
+    CD3D11_TEXTURE2D_DESC t2dDesc(DXGI_FORMAT_R16_FLOAT, (UINT)desc.m_DepthSize.x, (UINT)desc.m_DepthSize.y, 1, 1, D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET);
+    HRESULT hr = pDevice->CreateTexture2D(&t2dDesc, NULL, &m_t2dShadowMask);
+    if (hr == S_OK) hr = pDevice->CreateShaderResourceView(m_t2dShadowMask, NULL, &m_srvShadowMask);
+    if (hr == S_OK) hr = pDevice->CreateRenderTargetView(m_t2dShadowMask, NULL, &m_rtvShadowMask);
+    AMD_SAFE_RELEASE(pDevice);
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    m_Stats.m_ResourceCreateCount++;
+
+    m_ShadowMaskSize.x = desc.m_DepthSize.x;
+    m_ShadowMaskSize.y = desc.m_DepthSize.y;
 
     return SHADOWFX_RETURN_CODE_SUCCESS;
 }
@@ -232,6 +365,10 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createShaders(const ShadowFX_Desc & de
 void ShadowFX_OpaqueDesc::release()
 {
     releaseShaders();
+    releaseShadowMask();
+    releaseDepthBounds();
+    releaseStats();
+    releaseCapture();
 
     AMD_SAFE_RELEASE(m_cbShadowsData);
     AMD_SAFE_RELEASE(m_ssLinearClamp);
@@ -240,6 +377,10 @@ void ShadowFX_OpaqueDesc::release()
     AMD_SAFE_RELEASE(m_scsPointClamp);
     AMD_SAFE_RELEASE(m_scsPointBorder);
     AMD_SAFE_RELEASE(m_scsLinearBorder);
+    AMD_SAFE_RELEASE(m_ssPointWrap);
+    AMD_SAFE_RELEASE(m_ssLinearWrap);
+    AMD_SAFE_RELEASE(m_scsPointWrap);
+    AMD_SAFE_RELEASE(m_scsLinearWrap);
     AMD_SAFE_RELEASE(m_rsNoCulling);
     AMD_SAFE_RELEASE(m_dssEqualToRef);
     for (int i = 0; i < SHADOWFX_OUTPUT_CHANNEL_COUNT; i++)
@@ -264,6 +405,7 @@ void    ShadowFX_OpaqueDesc::releaseShaders()
                         {
                             AMD_SAFE_RELEASE(m_psShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize]);
                             AMD_SAFE_RELEASE(m_psShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize]);
+                            AMD_SAFE_RELEASE(m_psShadowT2DV[filter][execution][textureFetch][tapType][normalOption][filterSize]);
                             //AMD_SAFE_RELEASE( m_psShadowTC[filter][textureFetch][tapType][normalOption][filterSize] );
                             //AMD_SAFE_RELEASE( m_csShadowT2D[filter][textureFetch][tapType][normalOption][filterSize] );
                             //AMD_SAFE_RELEASE( m_csShadowT2DA[filter][textureFetch][tapType][normalOption][filterSize] );
@@ -278,13 +420,67 @@ void    ShadowFX_OpaqueDesc::releaseShaders()
         {
             AMD_SAFE_RELEASE(m_psShadowPointDebugT2D[execution][normalOption]);
             AMD_SAFE_RELEASE(m_psShadowPointDebugT2DA[execution][normalOption]);
+            AMD_SAFE_RELEASE(m_psShadowPointDebugT2DV[execution][normalOption]);
         }
+
+        AMD_SAFE_RELEASE(m_psShadowFeedback[execution]);
+        AMD_SAFE_RELEASE(m_csDepthBounds[execution]);
     }
 
+    AMD_SAFE_RELEASE(m_psShadowDenoise);
     AMD_SAFE_RELEASE(m_vsFullscreen);
 }
 
-SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
+void ShadowFX_OpaqueDesc::releaseShadowMask()
+{
+    AMD_SAFE_RELEASE(m_rtvShadowMask);
+    AMD_SAFE_RELEASE(m_srvShadowMask);
+    AMD_SAFE_RELEASE(m_t2dShadowMask);
+
+    m_ShadowMaskSize.x = 0.0f;
+    m_ShadowMaskSize.y = 0.0f;
+}
+
+void ShadowFX_OpaqueDesc::releaseDepthBounds()
+{
+    AMD_SAFE_RELEASE(m_uavDepthBounds);
+    AMD_SAFE_RELEASE(m_bufDepthBounds);
+
+    for (uint i = 0; i < m_DepthBoundsRingSize; i++)
+    {
+        AMD_SAFE_RELEASE(m_bufDepthBoundsReadback[i]);
+    }
+
+    m_DepthBoundsWrite = 0;
+    m_DepthBoundsPending = 0;
+}
+
+void ShadowFX_OpaqueDesc::releaseStats()
+{
+    for (uint i = 0; i < m_StatsRingSize; i++)
+    {
+        AMD_SAFE_RELEASE(m_StatsQuery[i].m_Disjoint);
+        AMD_SAFE_RELEASE(m_StatsQuery[i].m_Begin);
+        AMD_SAFE_RELEASE(m_StatsQuery[i].m_End);
+    }
+
+    m_StatsWrite = 0;
+    m_StatsPending = 0;
+}
+
+void ShadowFX_OpaqueDesc::releaseCapture()
+{
+    if (m_pCaptureFile != NULL)
+    {
+        fclose(m_pCaptureFile);
+        m_pCaptureFile = NULL;
+    }
+
+    m_CaptureFileName.clear();
+    m_CapturePending = false;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::updateConstantBuffer(const ShadowFX_Desc & desc)
 {
     if (desc.m_DepthSize.x == 0 ||
         desc.m_DepthSize.y == 0)
@@ -292,9 +488,6 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
         return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
     }
 
-
-    CD3D11_VIEWPORT FullscreenVP(0.0f, 0.0f, desc.m_DepthSize.x, desc.m_DepthSize.y);
-
     /*
       TODO: ADD MEMCMP CHECK THAT CONSTANT BUFFER VALUES ACTUALLY CHANGED
     */
@@ -319,6 +512,7 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
 
         m_ShadowsData.m_Light[i].m_ArraySlice = desc.m_ArraySlice[i];
         m_ShadowsData.m_Light[i].m_Weight.x = desc.m_Weight[i];
+        m_ShadowsData.m_Light[i].m_Weight.y = desc.m_TextureType == SHADOWFX_TEXTURE_2D_ARRAY && desc.m_ShadowWrap[i] ? 1.0f : 0.0f;
     }
 
     D3D11_MAPPED_SUBRESOURCE MappedResource;
@@ -326,6 +520,25 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
     memcpy(MappedResource.pData, &m_ShadowsData, sizeof(m_ShadowsData));
     desc.m_pContext->Unmap(m_cbShadowsData, 0);
 
+    m_Stats.m_ConstantBufferUploadCount++;
+    m_Stats.m_ConstantBufferUploadBytes += sizeof(m_ShadowsData);
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
+{
+    m_Stats.m_RenderCount++;
+
+    SHADOWFX_RETURN_CODE result = SHADOWFX_RETURN_CODE_SUCCESS;
+    {
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX constant buffer");
+        result = updateConstantBuffer(desc);
+    }
+    if (result != SHADOWFX_RETURN_CODE_SUCCESS) return result;
+
+    CD3D11_VIEWPORT FullscreenVP(0.0f, 0.0f, desc.m_DepthSize.x, desc.m_DepthSize.y);
+
     int filterSize = 0;
 
     switch (desc.m_FilterSize)
@@ -358,14 +571,89 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
             psSelect = m_psShadowPointDebugT2DA[desc.m_Execution][desc.m_NormalOption];
         break;
     }
+
+    case SHADOWFX_TEXTURE_2D_VIRTUAL:
+    {
+        if (desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+            psSelect = m_psShadowT2DV[desc.m_Filtering][desc.m_Execution][desc.m_TextureFetch][desc.m_TapType][desc.m_NormalOption][filterSize];
+        else
+            psSelect = m_psShadowPointDebugT2DV[desc.m_Execution][desc.m_NormalOption];
+        break;
+    }
     }
     ID3D11Buffer* cb[] ={m_cbShadowsData};
-    ID3D11SamplerState * ss[] ={m_ssPointClamp, m_ssLinearClamp, m_scsPointClamp, m_scsLinearClamp};
+    // s4-s7 are only read for the slices of wrapped lights (ShadowFX_Desc::m_ShadowWrap)
+    ID3D11SamplerState * ss[] ={m_ssPointClamp, m_ssLinearClamp, m_scsPointClamp, m_scsLinearClamp, m_ssPointWrap, m_ssLinearWrap, m_scsPointWrap, m_scsLinearWrap};
     ID3D11RenderTargetView* rtv[] ={desc.m_pOutputRTV};
 
     ID3D11BlendState * bsSelect = desc.m_pOutputBS != NULL ? desc.m_pOutputBS : m_bsOutputChannel[desc.m_OutputChannels];
 
-    ID3D11ShaderResourceView* srv[] ={desc.m_pDepthSRV, desc.m_pNormalSRV, desc.m_pShadowSRV};
+    ID3D11ShaderResourceView* srv[] ={desc.m_pDepthSRV, desc.m_pNormalSRV, desc.m_pShadowSRV, NULL, desc.m_pPageTableSRV};
+
+    if (psSelect == NULL)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    if (desc.m_TextureType == SHADOWFX_TEXTURE_2D_VIRTUAL && desc.m_pPageTableSRV == NULL)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX pass");
+
+    if (desc.m_TapType == SHADOWFX_TAP_TYPE_POISSON_ROTATED && desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+    {
+        result = createShadowMask(desc);
+        if (result != SHADOWFX_RETURN_CODE_SUCCESS) return result;
+
+        // the noisy mask is written for every pixel so the denoise pass never reads stale data.
+        // The application stencil and blend states are only applied when resolving into the output
+        ID3D11RenderTargetView* rtvMask[] ={m_rtvShadowMask};
+
+        StatsQuery* pQuery = beginStats(desc);
+
+        HRESULT hr = AMD::RenderFullscreenPass(desc.m_pContext,
+            FullscreenVP, m_vsFullscreen, psSelect,
+            NULL, 0, cb, AMD_ARRAY_SIZE(cb),
+            ss, AMD_ARRAY_SIZE(ss),
+            srv, AMD_ARRAY_SIZE(srv),
+            rtvMask, AMD_ARRAY_SIZE(rtvMask),
+            NULL, 0, 0,
+            NULL,
+            NULL, 0,
+            NULL,
+            m_rsNoCulling);
+        if (hr != S_OK)
+        {
+            endStats(desc, pQuery, 1);
+            return SHADOWFX_RETURN_CODE_FAIL;
+        }
+
+        ID3D11ShaderResourceView* srvDenoise[] ={desc.m_pDepthSRV, NULL, NULL, m_srvShadowMask};
+
+        hr = AMD::RenderFullscreenPass(desc.m_pContext,
+            FullscreenVP, m_vsFullscreen, m_psShadowDenoise,
+            NULL, 0, cb, AMD_ARRAY_SIZE(cb),
+            ss, AMD_ARRAY_SIZE(ss),
+            srvDenoise, AMD_ARRAY_SIZE(srvDenoise),
+            rtv, AMD_ARRAY_SIZE(rtv),
+            NULL, 0, 0,
+            desc.m_pOutputDSV,
+            desc.m_pOutputDSS, desc.m_ReferenceDSS,
+            bsSelect,
+            m_rsNoCulling);
+
+        endStats(desc, pQuery, 2);
+
+        // unbind the mask so it can be bound as a render target on the next call
+        ID3D11ShaderResourceView* srvNull[] ={NULL};
+        desc.m_pContext->PSSetShaderResources(3, AMD_ARRAY_SIZE(srvNull), srvNull);
+
+        return hr == S_OK ? SHADOWFX_RETURN_CODE_SUCCESS : SHADOWFX_RETURN_CODE_FAIL;
+    }
+
+    StatsQuery* pQuery = beginStats(desc);
 
     HRESULT hr = AMD::RenderFullscreenPass(desc.m_pContext,
         FullscreenVP, m_vsFullscreen, psSelect,
@@ -379,6 +667,440 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
         bsSelect,
         m_rsNoCulling);
 
+    endStats(desc, pQuery, 1);
+
+    return hr == S_OK ? SHADOWFX_RETURN_CODE_SUCCESS : SHADOWFX_RETURN_CODE_FAIL;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::renderFeedback(const ShadowFX_Desc & desc)
+{
+    if (desc.m_TextureType != SHADOWFX_TEXTURE_2D_VIRTUAL ||
+        desc.m_pFeedbackUAV == NULL)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_RETURN_CODE result = updateConstantBuffer(desc);
+    if (result != SHADOWFX_RETURN_CODE_SUCCESS) return result;
+
+    CD3D11_VIEWPORT FullscreenVP(0.0f, 0.0f, desc.m_DepthSize.x, desc.m_DepthSize.y);
+
+    // pages that no pixel requests keep the clear value (gu::virtual_page_not_requested)
+    const UINT notRequested[4] ={0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff};
+    desc.m_pContext->ClearUnorderedAccessViewUint(desc.m_pFeedbackUAV, notRequested);
+
+    ID3D11Buffer* cb[] ={m_cbShadowsData};
+    ID3D11SamplerState * ss[] ={m_ssPointClamp, m_ssLinearClamp, m_scsPointClamp, m_scsLinearClamp};
+    ID3D11ShaderResourceView* srv[] ={desc.m_pDepthSRV};
+    ID3D11UnorderedAccessView* uav[] ={desc.m_pFeedbackUAV};
+
+    HRESULT hr = AMD::RenderFullscreenPass(desc.m_pContext,
+        FullscreenVP, m_vsFullscreen, m_psShadowFeedback[desc.m_Execution],
+        NULL, 0, cb, AMD_ARRAY_SIZE(cb),
+        ss, AMD_ARRAY_SIZE(ss),
+        srv, AMD_ARRAY_SIZE(srv),
+        NULL, 0,
+        uav, 0, AMD_ARRAY_SIZE(uav),
+        desc.m_pOutputDSV,
+        desc.m_pOutputDSS, desc.m_ReferenceDSS,
+        NULL,
+        m_rsNoCulling);
+
     return hr == S_OK ? SHADOWFX_RETURN_CODE_SUCCESS : SHADOWFX_RETURN_CODE_FAIL;
 }
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createDepthBounds(const ShadowFX_Desc & desc)
+{
+    static_assert(m_DepthBoundsCount == SHADOWFX_DEPTH_BOUNDS_COUNT, "the depth bounds buffer holds the slots decoded by ShadowFX_DecodeDepthBounds");
+
+    if (m_bufDepthBounds != NULL)
+    {
+        return SHADOWFX_RETURN_CODE_SUCCESS;
+    }
+
+    // the device is taken from the context, the reduction runs in render() which may be called with only the context set
+    ID3D11Device* pDevice = NULL;
+    desc.m_pContext->GetDevice(&pDevice);
+
+    CD3D11_BUFFER_DESC bufDesc(m_DepthBoundsCount * sizeof(uint), D3D11_BIND_UNORDERED_ACCESS, D3D11_USAGE_DEFAULT, 0, D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS);
+    HRESULT hr = pDevice->CreateBuffer(&bufDesc, NULL, &m_bufDepthBounds);
+
+    CD3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc(D3D11_UAV_DIMENSION_BUFFER, DXGI_FORMAT_R32_TYPELESS, 0, m_DepthBoundsCount, 0, D3D11_BUFFER_UAV_FLAG_RAW);
+    if (hr == S_OK) hr = pDevice->CreateUnorderedAccessView(m_bufDepthBounds, &uavDesc, &m_uavDepthBounds);
+
+    CD3D11_BUFFER_DESC readbackDesc(m_DepthBoundsCount * sizeof(uint), 0, D3D11_USAGE_STAGING, D3D11_CPU_ACCESS_READ);
+    for (uint i = 0; i < m_DepthBoundsRingSize && hr == S_OK; i++)
+    {
+        hr = pDevice->CreateBuffer(&readbackDesc, NULL, &m_bufDepthBoundsReadback[i]);
+    }
+    AMD_SAFE_RELEASE(pDevice);
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    m_Stats.m_ResourceCreateCount++;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::reduceDepthBounds(const ShadowFX_Desc & desc)
+{
+    if (desc.m_pDepthSRV == NULL)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_RETURN_CODE result = updateConstantBuffer(desc);
+    if (result != SHADOWFX_RETURN_CODE_SUCCESS) return result;
+
+    result = createDepthBounds(desc);
+    if (result != SHADOWFX_RETURN_CODE_SUCCESS)
+    {
+        releaseDepthBounds();
+        return result;
+    }
+
+    const UINT empty[4] ={SHADOWFX_DEPTH_BOUNDS_EMPTY, SHADOWFX_DEPTH_BOUNDS_EMPTY, SHADOWFX_DEPTH_BOUNDS_EMPTY, SHADOWFX_DEPTH_BOUNDS_EMPTY};
+    desc.m_pContext->ClearUnorderedAccessViewUint(m_uavDepthBounds, empty);
+
+    ID3D11Buffer* cb[] ={m_cbShadowsData};
+    ID3D11ShaderResourceView* srv[] ={desc.m_pDepthSRV};
+    ID3D11UnorderedAccessView* uav[] ={m_uavDepthBounds};
+
+    desc.m_pContext->CSSetShader(m_csDepthBounds[desc.m_Execution], NULL, 0);
+    desc.m_pContext->CSSetConstantBuffers(0, AMD_ARRAY_SIZE(cb), cb);
+    desc.m_pContext->CSSetShaderResources(0, AMD_ARRAY_SIZE(srv), srv);
+    desc.m_pContext->CSSetUnorderedAccessViews(1, AMD_ARRAY_SIZE(uav), uav, NULL);
+
+    // the group size matches DEPTH_BOUNDS_TILE_SIZE in AMD_ShadowFX.hlsl
+    const uint tileSize = 8;
+    desc.m_pContext->Dispatch(((uint)desc.m_DepthSize.x + tileSize - 1) / tileSize, ((uint)desc.m_DepthSize.y + tileSize - 1) / tileSize, 1);
+
+    ID3D11UnorderedAccessView* uavNull[] ={NULL};
+    desc.m_pContext->CSSetUnorderedAccessViews(1, AMD_ARRAY_SIZE(uavNull), uavNull, NULL);
+
+    // when the ring is full the oldest copy that was never read is overwritten
+    desc.m_pContext->CopyResource(m_bufDepthBoundsReadback[m_DepthBoundsWrite], m_bufDepthBounds);
+    m_DepthBoundsWrite = (m_DepthBoundsWrite + 1) % m_DepthBoundsRingSize;
+    m_DepthBoundsPending = m_DepthBoundsPending < m_DepthBoundsRingSize ? m_DepthBoundsPending + 1 : m_DepthBoundsRingSize;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::getDepthBounds(const ShadowFX_Desc & desc, ShadowFX_DepthBounds & bounds)
+{
+    if (m_DepthBoundsPending == 0)
+    {
+        return SHADOWFX_RETURN_CODE_NOT_READY;
+    }
+
+    uint oldest = (m_DepthBoundsWrite + m_DepthBoundsRingSize - m_DepthBoundsPending) % m_DepthBoundsRingSize;
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    HRESULT hr = desc.m_pContext->Map(m_bufDepthBoundsReadback[oldest], 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+    if (hr == DXGI_ERROR_WAS_STILL_DRAWING) return SHADOWFX_RETURN_CODE_NOT_READY;
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+    ShadowFX_DecodeDepthBounds((const uint *)mapped.pData, bounds);
+    desc.m_pContext->Unmap(m_bufDepthBoundsReadback[oldest], 0);
+    m_DepthBoundsPending--;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createStats(const ShadowFX_Desc & desc)
+{
+    releaseStats();
+    memset(&m_Stats, 0, sizeof(m_Stats));
+
+    if (!desc.m_EnableStats)
+    {
+        return SHADOWFX_RETURN_CODE_SUCCESS;
+    }
+
+    CD3D11_QUERY_DESC disjointDesc(D3D11_QUERY_TIMESTAMP_DISJOINT);
+    CD3D11_QUERY_DESC timestampDesc(D3D11_QUERY_TIMESTAMP);
+    for (uint i = 0; i < m_StatsRingSize; i++)
+    {
+        HRESULT hr = desc.m_pDevice->CreateQuery(&disjointDesc, &m_StatsQuery[i].m_Disjoint);
+        if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+        hr = desc.m_pDevice->CreateQuery(&timestampDesc, &m_StatsQuery[i].m_Begin);
+        if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+        hr = desc.m_pDevice->CreateQuery(&timestampDesc, &m_StatsQuery[i].m_End);
+        if (hr != S_OK) return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+    }
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+ShadowFX_OpaqueDesc::StatsQuery* ShadowFX_OpaqueDesc::beginStats(const ShadowFX_Desc & desc)
+{
+    // no queries unless m_EnableStats was set at initialization
+    if (m_StatsQuery[m_StatsWrite].m_Disjoint == NULL)
+    {
+        return NULL;
+    }
+
+    // when the ring is full the oldest call that was never read is overwritten
+    StatsQuery* pQuery = &m_StatsQuery[m_StatsWrite];
+    desc.m_pContext->Begin(pQuery->m_Disjoint);
+    desc.m_pContext->End(pQuery->m_Begin);
+
+    return pQuery;
+}
+
+void ShadowFX_OpaqueDesc::endStats(const ShadowFX_Desc & desc, StatsQuery * pQuery, uint passCount)
+{
+    if (pQuery == NULL)
+    {
+        return;
+    }
+
+    desc.m_pContext->End(pQuery->m_End);
+    desc.m_pContext->End(pQuery->m_Disjoint);
+
+    pQuery->m_Call.m_GpuTimeRenderIndex = m_Stats.m_RenderCount;
+    pQuery->m_Call.m_GpuPassCount = passCount;
+    ShadowFX_SetStatsPermutation(pQuery->m_Call, desc);
+
+    m_StatsWrite = (m_StatsWrite + 1) % m_StatsRingSize;
+    m_StatsPending = m_StatsPending < m_StatsRingSize ? m_StatsPending + 1 : m_StatsRingSize;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::getStats(const ShadowFX_Desc & desc, ShadowFX_Stats & stats)
+{
+    // read every call the GPU has completed, oldest first, so the most recent GPU time is kept
+    while (m_StatsPending > 0)
+    {
+        StatsQuery & query = m_StatsQuery[(m_StatsWrite + m_StatsRingSize - m_StatsPending) % m_StatsRingSize];
+
+        D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+        UINT64 begin = 0, end = 0;
+        if (desc.m_pContext->GetData(query.m_Disjoint, &disjoint, sizeof(disjoint), 0) != S_OK ||
+            desc.m_pContext->GetData(query.m_Begin, &begin, sizeof(begin), 0) != S_OK ||
+            desc.m_pContext->GetData(query.m_End, &end, sizeof(end), 0) != S_OK)
+        {
+            break;
+        }
+
+        m_StatsPending--;
+
+        // the timestamps are meaningless if the GPU clock changed while the passes ran
+        if (!disjoint.Disjoint && disjoint.Frequency != 0)
+        {
+            ShadowFX_SetStatsGpuTime(m_Stats, query.m_Call, (float)((double)(end - begin) * 1000.0 / (double)disjoint.Frequency));
+        }
+    }
+
+    stats = m_Stats;
+
+    return m_Stats.m_GpuTimeRenderIndex == 0 ? SHADOWFX_RETURN_CODE_NOT_READY : SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+// bytes of a texel of the formats a capture reads back, 0 if the format is not supported
+static uint captureTexelSize(DXGI_FORMAT format)
+{
+    switch (format)
+    {
+    case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+    case DXGI_FORMAT_R32G32B32A32_FLOAT:
+        return 16;
+
+    case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+    case DXGI_FORMAT_R16G16B16A16_FLOAT:
+    case DXGI_FORMAT_R16G16B16A16_UNORM:
+    case DXGI_FORMAT_R16G16B16A16_SNORM:
+    case DXGI_FORMAT_R32G32_TYPELESS:
+    case DXGI_FORMAT_R32G32_FLOAT:
+    case DXGI_FORMAT_R32G8X24_TYPELESS:
+        return 8;
+
+    case DXGI_FORMAT_R10G10B10A2_TYPELESS:
+    case DXGI_FORMAT_R10G10B10A2_UNORM:
+    case DXGI_FORMAT_R11G11B10_FLOAT:
+    case DXGI_FORMAT_R8G8B8A8_TYPELESS:
+    case DXGI_FORMAT_R8G8B8A8_UNORM:
+    case DXGI_FORMAT_R8G8B8A8_SNORM:
+    case DXGI_FORMAT_R16G16_TYPELESS:
+    case DXGI_FORMAT_R16G16_FLOAT:
+    case DXGI_FORMAT_R16G16_UNORM:
+    case DXGI_FORMAT_R16G16_SNORM:
+    case DXGI_FORMAT_R32_TYPELESS:
+    case DXGI_FORMAT_R32_FLOAT:
+    case DXGI_FORMAT_R24G8_TYPELESS:
+        return 4;
+
+    case DXGI_FORMAT_R16_TYPELESS:
+    case DXGI_FORMAT_R16_FLOAT:
+    case DXGI_FORMAT_R16_UNORM:
+    case DXGI_FORMAT_R8G8_TYPELESS:
+    case DXGI_FORMAT_R8G8_UNORM:
+        return 2;
+
+    case DXGI_FORMAT_R8_TYPELESS:
+    case DXGI_FORMAT_R8_UNORM:
+        return 1;
+
+    default:
+        return 0;
+    }
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::copyCaptureTexture(const ShadowFX_Desc & desc, ID3D11View * pView, DXGI_FORMAT format, uint usage, CaptureTexture & texture)
+{
+    memset(&texture, 0, sizeof(texture));
+
+    ID3D11Resource* pResource = NULL;
+    pView->GetResource(&pResource);
+
+    ID3D11Texture2D* pTexture = NULL;
+    HRESULT hr = pResource->QueryInterface(__uuidof(ID3D11Texture2D), (void**)&pTexture);
+    AMD_SAFE_RELEASE(pResource);
+    if (hr != S_OK) return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+
+    // the view format tells the replay how to interpret the texels, the resource format may be typeless
+    D3D11_TEXTURE2D_DESC t2dDesc;
+    pTexture->GetDesc(&t2dDesc);
+    uint texelSize = captureTexelSize(t2dDesc.Format);
+    if (texelSize == 0 || t2dDesc.SampleDesc.Count != 1)
+    {
+        AMD_SAFE_RELEASE(pTexture);
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    texture.m_Header.m_Usage = usage;
+    texture.m_Header.m_Format = format != DXGI_FORMAT_UNKNOWN ? format : t2dDesc.Format;
+    texture.m_Header.m_Width = t2dDesc.Width;
+    texture.m_Header.m_Height = t2dDesc.Height;
+    texture.m_Header.m_ArraySize = t2dDesc.ArraySize;
+    texture.m_Header.m_RowPitch = t2dDesc.Width * texelSize;
+    texture.m_Header.m_DataSize = texture.m_Header.m_RowPitch * t2dDesc.Height * t2dDesc.ArraySize;
+    texture.m_MipLevels = t2dDesc.MipLevels;
+
+    t2dDesc.Usage = D3D11_USAGE_STAGING;
+    t2dDesc.BindFlags = 0;
+    t2dDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    t2dDesc.MiscFlags = 0;
+    ID3D11Device* pDevice = NULL;
+    desc.m_pContext->GetDevice(&pDevice);
+    hr = pDevice->CreateTexture2D(&t2dDesc, NULL, &texture.m_pStaging);
+    AMD_SAFE_RELEASE(pDevice);
+    if (hr != S_OK)
+    {
+        AMD_SAFE_RELEASE(pTexture);
+        return SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+    }
+
+    desc.m_pContext->CopyResource(texture.m_pStaging, pTexture);
+    AMD_SAFE_RELEASE(pTexture);
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::capture(const ShadowFX_Desc & desc)
+{
+    if (desc.m_pCaptureFile == NULL)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    if (m_pCaptureFile == NULL || m_CaptureFileName != desc.m_pCaptureFile)
+    {
+        releaseCapture();
+
+        m_pCaptureFile = ShadowFX_OpenCaptureFile(desc.m_pCaptureFile);
+        if (m_pCaptureFile == NULL) return SHADOWFX_RETURN_CODE_FAIL;
+        m_CaptureFileName = desc.m_pCaptureFile;
+    }
+
+    ShadowFX_CaptureCall call;
+    ShadowFX_SetCaptureCall(call, desc, SHADOWFX_CAPTURE_API_D3D11, m_Stats.m_RenderCount, 0);
+    call.m_OutputChannels = desc.m_pOutputBS == NULL ? desc.m_OutputChannels : 0;
+
+    // copy the requested textures, the normals are only read with SHADOWFX_NORMAL_OPTION_READ_FROM_SRV
+    static const uint textureCount = 4;
+    const uint usage[textureCount] ={SHADOWFX_CAPTURE_DEPTH, SHADOWFX_CAPTURE_NORMAL, SHADOWFX_CAPTURE_SHADOW, SHADOWFX_CAPTURE_OUTPUT};
+    ID3D11ShaderResourceView* pSRV[textureCount] ={desc.m_pDepthSRV, desc.m_NormalOption == SHADOWFX_NORMAL_OPTION_READ_FROM_SRV ? desc.m_pNormalSRV : NULL, desc.m_pShadowSRV, NULL};
+
+    CaptureTexture texture[textureCount];
+    SHADOWFX_RETURN_CODE result = SHADOWFX_RETURN_CODE_SUCCESS;
+    for (uint i = 0; i < textureCount && result == SHADOWFX_RETURN_CODE_SUCCESS; i++)
+    {
+        if ((desc.m_CaptureFlags & usage[i]) == 0) continue;
+
+        ID3D11View* pView = NULL;
+        DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+        if (usage[i] == SHADOWFX_CAPTURE_OUTPUT && desc.m_pOutputRTV != NULL)
+        {
+            D3D11_RENDER_TARGET_VIEW_DESC rtvDesc;
+            desc.m_pOutputRTV->GetDesc(&rtvDesc);
+            pView = desc.m_pOutputRTV;
+            format = rtvDesc.Format;
+        }
+        else if (pSRV[i] != NULL)
+        {
+            D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+            pSRV[i]->GetDesc(&srvDesc);
+            pView = pSRV[i];
+            format = srvDesc.Format;
+        }
+        if (pView == NULL) continue;
+
+        result = copyCaptureTexture(desc, pView, format, usage[i], texture[call.m_TextureCount]);
+        if (result == SHADOWFX_RETURN_CODE_SUCCESS)
+        {
+            call.m_Size += sizeof(ShadowFX_CaptureTexture) + texture[call.m_TextureCount].m_Header.m_DataSize;
+            call.m_TextureCount++;
+        }
+    }
+
+    m_CapturePending = true;
+
+    // the record size is known before any byte is written, so a failed read back only zeroes texels and the stream stays readable
+    bool written = result == SHADOWFX_RETURN_CODE_SUCCESS && fwrite(&call, sizeof(call), 1, m_pCaptureFile) == 1;
+    for (uint i = 0; i < call.m_TextureCount; i++)
+    {
+        const ShadowFX_CaptureTexture & header = texture[i].m_Header;
+        written = written && fwrite(&header, sizeof(header), 1, m_pCaptureFile) == 1;
+
+        for (uint slice = 0; slice < header.m_ArraySize && written; slice++)
+        {
+            D3D11_MAPPED_SUBRESOURCE mapped;
+            HRESULT hr = desc.m_pContext->Map(texture[i].m_pStaging, D3D11CalcSubresource(0, slice, texture[i].m_MipLevels), D3D11_MAP_READ, 0, &mapped);
+            if (hr != S_OK) result = SHADOWFX_RETURN_CODE_D3D11_CALL_FAILED;
+
+            for (uint row = 0; row < header.m_Height && written; row++)
+            {
+                if (hr == S_OK)
+                {
+                    written = fwrite((const char*)mapped.pData + row * mapped.RowPitch, header.m_RowPitch, 1, m_pCaptureFile) == 1;
+                }
+                else
+                {
+                    for (uint b = 0; b < header.m_RowPitch && written; b++)
+                        written = fputc(0, m_pCaptureFile) != EOF;
+                }
+            }
+
+            if (hr == S_OK) desc.m_pContext->Unmap(texture[i].m_pStaging, D3D11CalcSubresource(0, slice, texture[i].m_MipLevels));
+        }
+
+        AMD_SAFE_RELEASE(texture[i].m_pStaging);
+    }
+
+    if (result != SHADOWFX_RETURN_CODE_SUCCESS) return result;
+    if (!written) return SHADOWFX_RETURN_CODE_FAIL;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::flushCapture()
+{
+    if (!m_CapturePending) return SHADOWFX_RETURN_CODE_SUCCESS;
+
+    m_CapturePending = false;
+    if (m_pCaptureFile != NULL && fflush(m_pCaptureFile) != 0) return SHADOWFX_RETURN_CODE_FAIL;
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
 }
\ No newline at end of file
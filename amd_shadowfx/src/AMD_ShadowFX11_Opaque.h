@@ -25,6 +25,8 @@
 
 #include "AMD_LIB.h"
 #include "AMD_ShadowFX.h"
+#include <stdio.h>
+#include <string>
 
 #pragma warning( disable : 4996 ) // disable stdio deprecated message
 
@@ -53,7 +55,7 @@ public:
             float2                               m_SizeInv;
             float4                               m_Region;
 
-            float4                               m_Weight;
+            float4                               m_Weight; // .x weight, .y 1 for a wrapped array slice
 
             float                                m_SunArea;
             float                                m_DepthTestOffset;
@@ -73,6 +75,7 @@ public:
 
     ID3D11PixelShader*                           m_psShadowT2D[SHADOWFX_FILTERING_COUNT][SHADOWFX_EXECUTION_COUNT][SHADOWFX_TEXTURE_FETCH_COUNT][SHADOWFX_TAP_TYPE_COUNT][SHADOWFX_NORMAL_OPTION_COUNT][SHADOWFX_FILTER_SIZE_COUNT];
     ID3D11PixelShader*                           m_psShadowT2DA[SHADOWFX_FILTERING_COUNT][SHADOWFX_EXECUTION_COUNT][SHADOWFX_TEXTURE_FETCH_COUNT][SHADOWFX_TAP_TYPE_COUNT][SHADOWFX_NORMAL_OPTION_COUNT][SHADOWFX_FILTER_SIZE_COUNT];
+    ID3D11PixelShader*                           m_psShadowT2DV[SHADOWFX_FILTERING_COUNT][SHADOWFX_EXECUTION_COUNT][SHADOWFX_TEXTURE_FETCH_COUNT][SHADOWFX_TAP_TYPE_COUNT][SHADOWFX_NORMAL_OPTION_COUNT][SHADOWFX_FILTER_SIZE_COUNT];
     //ID3D11PixelShader*                         m_psShadowTC[SHADOWFX_FILTERING_COUNT][SHADOWFX_TEXTURE_FETCH_COUNT][SHADOWFX_TAP_TYPE_COUNT][SHADOWFX_NORMAL_OPTION_COUNT][SHADOWFX_FILTER_SIZE_COUNT];
 
     //ID3D11ComputeShader*                       m_csShadowT2D[SHADOWFX_FILTERING_COUNT][SHADOWFX_TEXTURE_FETCH_COUNT][SHADOWFX_TAP_TYPE_COUNT][SHADOWFX_NORMAL_OPTION_COUNT][SHADOWFX_FILTER_SIZE_COUNT];
@@ -81,14 +84,68 @@ public:
 
     ID3D11PixelShader*                           m_psShadowPointDebugT2D[SHADOWFX_EXECUTION_COUNT][SHADOWFX_NORMAL_OPTION_COUNT];
     ID3D11PixelShader*                           m_psShadowPointDebugT2DA[SHADOWFX_EXECUTION_COUNT][SHADOWFX_NORMAL_OPTION_COUNT];
+    ID3D11PixelShader*                           m_psShadowPointDebugT2DV[SHADOWFX_EXECUTION_COUNT][SHADOWFX_NORMAL_OPTION_COUNT];
+
+    // virtual shadow map page requests
+    ID3D11PixelShader*                           m_psShadowFeedback[SHADOWFX_EXECUTION_COUNT];
+
+    // depth bounds reduction: uints reduced with atomics (see shadowDepthBounds) and copied to a readback ring
+    static const uint                            m_DepthBoundsCount = 2 + 6 * ShadowFX_Desc::m_MaxLightCount;
+    static const uint                            m_DepthBoundsRingSize = 2;
+    ID3D11ComputeShader*                         m_csDepthBounds[SHADOWFX_EXECUTION_COUNT];
+    ID3D11Buffer*                                m_bufDepthBounds;
+    ID3D11UnorderedAccessView*                   m_uavDepthBounds;
+    ID3D11Buffer*                                m_bufDepthBoundsReadback[m_DepthBoundsRingSize];
+    uint                                         m_DepthBoundsWrite; // next readback buffer to copy into
+    uint                                         m_DepthBoundsPending; // number of copies not read yet
+
+    // GPU timing of render (m_EnableStats): the passes of every call are surrounded by timestamp queries
+    // kept in a ring that getStats reads without stalling
+    typedef struct StatsQuery_t
+    {
+        ID3D11Query*                             m_Disjoint;
+        ID3D11Query*                             m_Begin;
+        ID3D11Query*                             m_End;
+        ShadowFX_Stats                           m_Call; // render index, pass count and permutation of the timed call
+    } StatsQuery;
+
+    static const uint                            m_StatsRingSize = 4;
+    StatsQuery                                   m_StatsQuery[m_StatsRingSize];
+    uint                                         m_StatsWrite; // next query set to issue
+    uint                                         m_StatsPending; // number of timed calls not read yet
+    ShadowFX_Stats                               m_Stats; // counters and the most recent GPU time read
     //ID3D11PixelShader*                         m_psShadowPointDebugTC[SHADOWFX_NORMAL_OPTION_COUNT];
 
+    // capture of render (m_EnableCapture): the calls are appended to a file kept open while its name doesn't change.
+    // The textures of a call are copied to staging textures and written once the whole record size is known
+    typedef struct CaptureTexture_t
+    {
+        ShadowFX_CaptureTexture                  m_Header;
+        ID3D11Texture2D*                         m_pStaging;
+        uint                                     m_MipLevels;
+    } CaptureTexture;
+
+    FILE*                                        m_pCaptureFile;
+    std::string                                  m_CaptureFileName;
+    bool                                         m_CapturePending; // records buffered since the last flush
+
+    // rotated poisson taps are filtered into an internal mask which is then denoised into the output rtv
+    ID3D11PixelShader*                           m_psShadowDenoise;
+    ID3D11Texture2D*                             m_t2dShadowMask;
+    ID3D11ShaderResourceView*                    m_srvShadowMask;
+    ID3D11RenderTargetView*                      m_rtvShadowMask;
+    float2                                       m_ShadowMaskSize;
+
     ID3D11SamplerState*                          m_ssPointClamp;
     ID3D11SamplerState*                          m_ssLinearClamp;
     ID3D11SamplerState*                          m_scsPointBorder;
     ID3D11SamplerState*                          m_scsLinearBorder;
     ID3D11SamplerState*                          m_scsPointClamp;
     ID3D11SamplerState*                          m_scsLinearClamp;
+    ID3D11SamplerState*                          m_ssPointWrap;
+    ID3D11SamplerState*                          m_ssLinearWrap;
+    ID3D11SamplerState*                          m_scsPointWrap;
+    ID3D11SamplerState*                          m_scsLinearWrap;
 
     ID3D11RasterizerState*                       m_rsNoCulling;
     ID3D11DepthStencilState*                     m_dssEqualToRef;
@@ -99,11 +156,29 @@ public:
 
     SHADOWFX_RETURN_CODE                         cbInitialize(const ShadowFX_Desc & desc);
     SHADOWFX_RETURN_CODE                         createShaders(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         createShadowMask(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         createDepthBounds(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         createStats(const ShadowFX_Desc & desc);
 
     SHADOWFX_RETURN_CODE                         render(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         renderFeedback(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         reduceDepthBounds(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         getDepthBounds(const ShadowFX_Desc & desc, ShadowFX_DepthBounds & bounds);
+    SHADOWFX_RETURN_CODE                         getStats(const ShadowFX_Desc & desc, ShadowFX_Stats & stats);
+    SHADOWFX_RETURN_CODE                         updateConstantBuffer(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         capture(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         flushCapture();
+    SHADOWFX_RETURN_CODE                         copyCaptureTexture(const ShadowFX_Desc & desc, ID3D11View * pView, DXGI_FORMAT format, uint usage, CaptureTexture & texture);
+
+    StatsQuery*                                  beginStats(const ShadowFX_Desc & desc);
+    void                                         endStats(const ShadowFX_Desc & desc, StatsQuery * pQuery, uint passCount);
 
     void                                         release();
     void                                         releaseShaders();
+    void                                         releaseShadowMask();
+    void                                         releaseDepthBounds();
+    void                                         releaseStats();
+    void                                         releaseCapture();
 };
 
 #endif // AMD_SHADOWFX_OPAQUE_H
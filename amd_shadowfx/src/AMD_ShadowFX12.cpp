@@ -32,6 +32,8 @@
 #endif
 
 #include "AMD_ShadowFX12_Opaque.h"
+#include "AMD_ShadowFX_Profile.h"
+#include "AMD_ShadowFX_DepthBounds.h"
 
 #pragma warning( disable : 4996 )// disable stdio deprecated
 
@@ -39,6 +41,10 @@ namespace AMD
 {
     ShadowFX_Desc::ShadowFX_Desc()
         : m_EnableCapture(false)
+        , m_pCaptureFile(NULL)
+        , m_CaptureFlags(0)
+        , m_EnableStats(false)
+        , m_pProfiler(NULL)
         , m_TextureType(SHADOWFX_TEXTURE_2D)
         , m_Filtering(SHADOWFX_FILTERING_DEBUG_POINT)
         , m_TextureFetch(SHADOWFX_TEXTURE_FETCH_PCF)
@@ -48,6 +54,9 @@ namespace AMD
         , m_Execution(SHADOWFX_EXECUTION_UNION)
         , m_NormalOption(SHADOWFX_NORMAL_OPTION_NONE)
         , m_pDevice(NULL)
+        , m_pCommandQueue(NULL)
+        , m_pStatsFence(NULL)
+        , m_StatsFenceValue(0)
         , m_pOpaque(NULL)
         , m_pDepth(NULL)
         , m_pShadow(NULL)
@@ -60,6 +69,11 @@ namespace AMD
         , m_InstanceID(0)
         , m_PreserveViewport(false)
     {
+        for (uint i = 0; i < m_MaxLightCount; i++)
+        {
+            m_ShadowWrap[i] = false;
+        }
+
         static ShadowFX_OpaqueDesc opaque(*this);
         m_pOpaque = &opaque;
     }
@@ -96,7 +110,45 @@ namespace AMD
 
     SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_Render(const ShadowFX_Desc & desc)
     {
-        return desc.m_pOpaque->render(desc);;
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX_Render");
+        return desc.m_pOpaque->render(desc);
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_RenderFeedback(const ShadowFX_Desc & /*desc*/)
+    {
+        // virtual shadow maps are not implemented in DX12
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_ReduceDepthBounds(const ShadowFX_Desc & /*desc*/)
+    {
+        // the depth bounds reduction is not implemented in DX12
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_GetDepthBounds(const ShadowFX_Desc & /*desc*/, ShadowFX_DepthBounds * /*pBounds*/)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_ReduceDepthBoundsCPU(const ShadowFX_Desc & desc, const float * pDepth, uint rowPitch, ShadowFX_DepthBounds * pBounds)
+    {
+        if (NULL == pDepth || NULL == pBounds)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_POINTER;
+        }
+
+        return ShadowFX_ReduceDepthBoundsReference(desc, pDepth, rowPitch, *pBounds);
+    }
+
+    SHADOWFX_RETURN_CODE AMD_SHADOWFX_DLL_API AMD::ShadowFX_GetStats(const ShadowFX_Desc & desc, ShadowFX_Stats * pStats)
+    {
+        if (NULL == pStats)
+        {
+            return SHADOWFX_RETURN_CODE_INVALID_POINTER;
+        }
+
+        return desc.m_pOpaque->getStats(desc, *pStats);
     }
 
 }
@@ -33,6 +33,7 @@
 
 #include "AMD_ShadowFX12_Opaque.h"
 #include "AMD_ShadowFX_Precompiled.h"
+#include "AMD_ShadowFX_Profile.h"
 
 #pragma warning( disable : 4100 ) // disable unreference formal parameter warnings for /W4 builds
 
@@ -44,9 +45,17 @@ namespace
     // different permutations of shadow_fx parameters use different shaders
     // compiling PSOs for all permutations would be very slow
     // this structure keeps the data needed to create the PSOs and create them in a lazy manner
-    // returns the PSO or nullptr in case of error
-    ID3D12PipelineState* get(ID3D12Device* dev, AMD::shadowfx_pipeline_state_object& pso)
+    // a created PSO is published in pso.ready, so the lock is only taken by the first uses of a permutation
+    // returns the PSO or nullptr in case of error. num_created counts the PSOs created
+    ID3D12PipelineState* get(ID3D12Device* dev, AMD::shadowfx_pipeline_state_object& pso, std::atomic<std::uint32_t>& num_created, std::mutex& mutex)
     {
+        ID3D12PipelineState* ready = pso.ready.load(std::memory_order_acquire);
+        if (ready != nullptr)
+        {
+            return ready;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
         if (pso.pso.Get() == nullptr)
         {
             assert(dev != nullptr);
@@ -55,6 +64,8 @@ namespace
             {
                 return nullptr;
             }
+            ++num_created;
+            pso.ready.store(pso.pso.Get(), std::memory_order_release);
         }
         return pso.pso.Get();
     }
@@ -125,8 +136,8 @@ namespace
         CD3DX12_ROOT_PARAMETER root_param[1];
         root_param[0].InitAsDescriptorTable(static_cast<uint32_t>(AMD::ShadowFX_OpaqueDesc::m_num_srd_heap_slot), descriptor_table, D3D12_SHADER_VISIBILITY_PIXEL);
 
-        // static samplers
-        static std::uint32_t const num_static_sampler = 4;
+        // static samplers, s4-s7 wrap the slices of wrapped lights (ShadowFX_Desc::m_ShadowWrap)
+        static std::uint32_t const num_static_sampler = 8;
         D3D12_STATIC_SAMPLER_DESC sampler[num_static_sampler] = {};
 
         sampler[0].Filter = D3D12_FILTER_MIN_MAG_MIP_POINT;
@@ -156,6 +167,15 @@ namespace
         sampler[3].Filter = D3D12_FILTER_MIN_MAG_MIP_LINEAR;
         sampler[3].ShaderRegister = 3;
 
+        for (std::uint32_t i = 4; i < num_static_sampler; ++i)
+        {
+            sampler[i] = sampler[i - 4];
+            sampler[i].AddressU = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+            sampler[i].AddressV = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+            sampler[i].AddressW = D3D12_TEXTURE_ADDRESS_MODE_WRAP;
+            sampler[i].ShaderRegister = i;
+        }
+
         // flags
         D3D12_ROOT_SIGNATURE_FLAGS flag = D3D12_ROOT_SIGNATURE_FLAG_DENY_VERTEX_SHADER_ROOT_ACCESS
             | D3D12_ROOT_SIGNATURE_FLAG_DENY_HULL_SHADER_ROOT_ACCESS
@@ -248,6 +268,12 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::init(const ShadowFX_Desc & desc)
     }
 
     r = createPSO(desc);
+    if (r != SHADOWFX_RETURN_CODE_SUCCESS)
+    {
+        return r;
+    }
+
+    r = createStats(desc);
 
     return r;
 }
@@ -331,17 +357,21 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createPSO(const ShadowFX_Desc & desc)
                     {
                         for (int filterSize = 0; filterSize < SHADOWFX_FILTER_SIZE_COUNT; filterSize++)
                         {
+                            // rotated poisson is rejected by render(): it needs the denoise pass, which is only implemented in DX11
+                            if (tapType == SHADOWFX_TAP_TYPE_POISSON_ROTATED)
+                            {
+                                continue;
+                            }
+
                             int idx = filterSize;
                             idx += normalOption * SHADOWFX_FILTER_SIZE_COUNT;
                             idx += tapType * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT;
-                            idx += textureFetch * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT;
-                            idx += execution * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT;
-                            idx += filter * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * SHADOWFX_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT * SHADOWFX_EXECUTION_COUNT;
+                            idx += textureFetch * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT;
+                            idx += execution * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT;
+                            idx += filter * SHADOWFX_FILTER_SIZE_COUNT * SHADOWFX_NORMAL_OPTION_COUNT * PS_SF_TAP_TYPE_COUNT * SHADOWFX_TEXTURE_FETCH_COUNT * SHADOWFX_EXECUTION_COUNT;
 
                             assert(idx < std::extent<decltype(PS_SF_T2D_Size)>::value);
                             assert(idx < std::extent<decltype(PS_SF_T2D_Data)>::value);
-                            assert(idx < std::extent<decltype(PS_SF_T2DA_Size)>::value);
-                            assert(idx < std::extent<decltype(PS_SF_T2DA_Data)>::value);
 
                             // T2D
                             {
@@ -350,6 +380,9 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createPSO(const ShadowFX_Desc & desc)
                                 pso.pso_desc.PS = { PS_SF_T2D_Data[idx] , static_cast<size_t>(PS_SF_T2D_Size[idx]) };
                             }
 
+                            assert(idx < std::extent<decltype(PS_SF_T2DA_Size)>::value);
+                            assert(idx < std::extent<decltype(PS_SF_T2DA_Data)>::value);
+
                             // T2DA
                             {
                                 auto& pso = psoShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize];
@@ -390,9 +423,178 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createPSO(const ShadowFX_Desc & desc)
     return SHADOWFX_RETURN_CODE_SUCCESS;
 }
 
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::createStats(const ShadowFX_Desc & desc)
+{
+    m_num_render = 0;
+    m_num_pso_created = 0;
+    m_num_cb_upload = 0;
+    m_cb_upload_bytes = 0;
+
+    m_stats_query_heap = nullptr;
+    m_stats_readback = nullptr;
+    m_stats_instance.assign(m_num_cb_instance, shadowfx_stats_instance{});
+
+    if (!desc.m_EnableStats)
+    {
+        return SHADOWFX_RETURN_CODE_SUCCESS;
+    }
+
+    auto num_query = 2 * shadowfx_stats_instance::num_slot * m_num_cb_instance;
+
+    D3D12_QUERY_HEAP_DESC heap_desc = {};
+    heap_desc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    heap_desc.Count = static_cast<UINT>(num_query);
+    HRESULT r = desc.m_pDevice->CreateQueryHeap(&heap_desc, IID_PPV_ARGS(&m_stats_query_heap));
+    if (FAILED(r))
+    {
+        return SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED;
+    }
+
+    auto readback_heap = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK);
+    auto buffer_desc = CD3DX12_RESOURCE_DESC::Buffer(num_query * sizeof(std::uint64_t));
+    r = desc.m_pDevice->CreateCommittedResource(&readback_heap, D3D12_HEAP_FLAG_NONE,
+        &buffer_desc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&m_stats_readback));
+    if (FAILED(r))
+    {
+        m_stats_query_heap = nullptr;
+        return SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED;
+    }
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::getStats(const ShadowFX_Desc & desc, ShadowFX_Stats & stats)
+{
+    stats = {};
+    stats.m_RenderCount = m_num_render;
+    stats.m_PipelineCreateCount = m_num_pso_created;
+    stats.m_ConstantBufferUploadCount = m_num_cb_upload;
+    stats.m_ConstantBufferUploadBytes = m_cb_upload_bytes;
+
+    if (m_stats_query_heap == nullptr || desc.m_InstanceID >= m_stats_instance.size())
+    {
+        return SHADOWFX_RETURN_CODE_NOT_READY;
+    }
+
+    if (desc.m_pCommandQueue == nullptr || desc.m_pStatsFence == nullptr)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    // the most recent call of the ring whose fence the gpu has reached. Its timestamps are resolved and won't be
+    // overwritten before another call is recorded in the slot
+    auto& instance = m_stats_instance[desc.m_InstanceID];
+    UINT64 completed = desc.m_pStatsFence->GetCompletedValue();
+    std::size_t num_recent = instance.num_call < shadowfx_stats_instance::num_slot ? instance.num_call : shadowfx_stats_instance::num_slot;
+    std::size_t slot = shadowfx_stats_instance::num_slot;
+    for (std::size_t i = 1; i <= num_recent; ++i)
+    {
+        std::size_t s = (instance.num_call - i) % shadowfx_stats_instance::num_slot;
+        if (instance.fence[s] != 0 && instance.fence[s] <= completed)
+        {
+            slot = s;
+            break;
+        }
+    }
+    if (slot == shadowfx_stats_instance::num_slot)
+    {
+        return SHADOWFX_RETURN_CODE_NOT_READY;
+    }
+
+    auto first = 2 * (desc.m_InstanceID * shadowfx_stats_instance::num_slot + slot);
+
+    std::uint64_t* ts = nullptr;
+    D3D12_RANGE read_range = { first * sizeof(std::uint64_t), (first + 2) * sizeof(std::uint64_t) };
+    HRESULT r = m_stats_readback->Map(0, &read_range, reinterpret_cast<void**>(&ts));
+    if (FAILED(r))
+    {
+        return SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED;
+    }
+    std::uint64_t begin = ts[first];
+    std::uint64_t end = ts[first + 1];
+    D3D12_RANGE write_range = { 0, 0 };
+    m_stats_readback->Unmap(0, &write_range);
+
+    UINT64 freq = 0;
+    r = desc.m_pCommandQueue->GetTimestampFrequency(&freq);
+    if (FAILED(r) || freq == 0)
+    {
+        return SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED;
+    }
+
+    ShadowFX_SetStatsGpuTime(stats, instance.call[slot], end > begin ? static_cast<float>(static_cast<double>(end - begin) * 1000.0 / static_cast<double>(freq)) : 0.0f);
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::capture(const ShadowFX_Desc & desc, std::uint32_t render_index)
+{
+    if (desc.m_pCaptureFile == nullptr)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    ShadowFX_CaptureCall call;
+    ShadowFX_SetCaptureCall(call, desc, SHADOWFX_CAPTURE_API_D3D12, render_index, desc.m_InstanceID);
+
+    std::lock_guard<std::mutex> lock(m_capture_mutex);
+
+    if (m_capture_file == nullptr || m_capture_file_name != desc.m_pCaptureFile)
+    {
+        if (m_capture_file != nullptr)
+        {
+            std::fclose(m_capture_file);
+        }
+
+        m_capture_file = ShadowFX_OpenCaptureFile(desc.m_pCaptureFile);
+        m_capture_file_name = m_capture_file != nullptr ? desc.m_pCaptureFile : "";
+        if (m_capture_file == nullptr)
+        {
+            return SHADOWFX_RETURN_CODE_FAIL;
+        }
+    }
+
+    m_capture_pending = true;
+    if (std::fwrite(&call, sizeof(call), 1, m_capture_file) != 1)
+    {
+        return SHADOWFX_RETURN_CODE_FAIL;
+    }
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::flushCapture()
+{
+    if (!m_capture_pending.exchange(false))
+    {
+        return SHADOWFX_RETURN_CODE_SUCCESS;
+    }
+
+    std::lock_guard<std::mutex> lock(m_capture_mutex);
+    if (m_capture_file != nullptr && std::fflush(m_capture_file) != 0)
+    {
+        return SHADOWFX_RETURN_CODE_FAIL;
+    }
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
 void ShadowFX_OpaqueDesc::release()
 {
     // explicitly release data
+    {
+        std::lock_guard<std::mutex> lock(m_capture_mutex);
+        if (m_capture_file != nullptr)
+        {
+            std::fclose(m_capture_file);
+            m_capture_file = nullptr;
+        }
+        m_capture_file_name.clear();
+        m_capture_pending = false;
+    }
+    m_stats_query_heap = nullptr;
+    m_stats_readback = nullptr;
+    m_stats_instance.clear();
     m_sh_mask_cb_mem =  nullptr;
     m_srd_heap.heap = nullptr;
     m_srd_heap.num_slot = 0;
@@ -411,9 +613,11 @@ void ShadowFX_OpaqueDesc::release()
                         {
                             // T2D
                             psoShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize].pso = nullptr;
+                            psoShadowT2D[filter][execution][textureFetch][tapType][normalOption][filterSize].ready = nullptr;
 
                             // T2DA
                             psoShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize].pso = nullptr;
+                            psoShadowT2DA[filter][execution][textureFetch][tapType][normalOption][filterSize].ready = nullptr;
                         }
                     }
                 }
@@ -427,9 +631,11 @@ void ShadowFX_OpaqueDesc::release()
         {
             // T2D
             psoShadowPointDebugT2D[execution][normalOption].pso = nullptr;
+            psoShadowPointDebugT2D[execution][normalOption].ready = nullptr;
 
             // T2DA
             psoShadowPointDebugT2DA[execution][normalOption].pso = nullptr;
+            psoShadowPointDebugT2DA[execution][normalOption].ready = nullptr;
         }
     }
 }
@@ -443,17 +649,28 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
         return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
     }
 
+    // the rotated mask is only usable after the denoise pass, which needs an intermediate target the DX12 path doesn't own
+    if (desc.m_TapType == SHADOWFX_TAP_TYPE_POISSON_ROTATED && desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    std::uint32_t render_index = ++m_num_render;
+
     std::size_t inst_id = desc.m_InstanceID;
     auto cb_sz = align_to_page(sizeof(ShadowsData));
     auto cb_ptr = reinterpret_cast<ShadowsData*>(m_sh_mask_cb_ptr + inst_id * cb_sz);
 
     ID3D12GraphicsCommandList* cl = desc.m_CommandList;
 
-    desc.m_pDevice->CreateShaderResourceView(desc.m_pDepth, &desc.m_DepthSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 1));
-    desc.m_pDevice->CreateShaderResourceView(desc.m_pShadow, &desc.m_ShadowSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 3));
-    if (desc.m_pNormal != nullptr)
     {
-        desc.m_pDevice->CreateShaderResourceView(desc.m_pNormal, &desc.m_NormalSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 2));
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX create SRV");
+        desc.m_pDevice->CreateShaderResourceView(desc.m_pDepth, &desc.m_DepthSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 1));
+        desc.m_pDevice->CreateShaderResourceView(desc.m_pShadow, &desc.m_ShadowSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 3));
+        if (desc.m_pNormal != nullptr)
+        {
+            desc.m_pDevice->CreateShaderResourceView(desc.m_pNormal, &desc.m_NormalSRV, get_cpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 2));
+        }
     }
 
     int filterSize = 0;
@@ -469,31 +686,39 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
 
     ID3D12PipelineState* pso = nullptr;
 
-    if (desc.m_TextureType == SHADOWFX_TEXTURE_2D)
+    // the first use of a permutation creates its pso, which shows up as a spike in this zone
     {
-        if (desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX PSO lookup");
+        if (desc.m_TextureType == SHADOWFX_TEXTURE_2D)
         {
-            pso = get(desc.m_pDevice, psoShadowT2D[desc.m_Filtering][desc.m_Execution][desc.m_TextureFetch][desc.m_TapType][desc.m_NormalOption][filterSize]);
+            if (desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+            {
+                pso = get(desc.m_pDevice, psoShadowT2D[desc.m_Filtering][desc.m_Execution][desc.m_TextureFetch][desc.m_TapType][desc.m_NormalOption][filterSize], m_num_pso_created, m_pso_mutex);
+            }
+            else
+            {
+                pso = get(desc.m_pDevice, psoShadowPointDebugT2D[desc.m_Execution][desc.m_NormalOption], m_num_pso_created, m_pso_mutex);
+            }
         }
-        else
+        else if(desc.m_TextureType == SHADOWFX_TEXTURE_2D_ARRAY)
         {
-            pso = get(desc.m_pDevice, psoShadowPointDebugT2D[desc.m_Execution][desc.m_NormalOption]);
+            if (desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
+            {
+                pso = get(desc.m_pDevice, psoShadowT2DA[desc.m_Filtering][desc.m_Execution][desc.m_TextureFetch][desc.m_TapType][desc.m_NormalOption][filterSize], m_num_pso_created, m_pso_mutex);
+            }
+            else
+            {
+                pso = get(desc.m_pDevice, psoShadowPointDebugT2DA[desc.m_Execution][desc.m_NormalOption], m_num_pso_created, m_pso_mutex);
+            }
         }
     }
-    else if(desc.m_TextureType == SHADOWFX_TEXTURE_2D_ARRAY)
+
+    // the PSO creation failed
+    if (pso == nullptr)
     {
-        if (desc.m_Filtering != SHADOWFX_FILTERING_DEBUG_POINT)
-        {
-            pso = get(desc.m_pDevice, psoShadowT2DA[desc.m_Filtering][desc.m_Execution][desc.m_TextureFetch][desc.m_TapType][desc.m_NormalOption][filterSize]);
-        }
-        else
-        {
-            pso = get(desc.m_pDevice, psoShadowPointDebugT2DA[desc.m_Execution][desc.m_NormalOption]);
-        }
+        return SHADOWFX_RETURN_CODE_D3D12_CALL_FAILED;
     }
 
-    assert(pso != nullptr);
-
     // set viewport and scissor
     if (!desc.m_PreserveViewport)
     {
@@ -504,26 +729,33 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
     cl->SetGraphicsRootSignature(m_sh_mask_rs.Get());
     cl->SetPipelineState(pso);
 
-    cb_ptr->m_ActiveLightCount = desc.m_ActiveLightCount;
-    memcpy(&cb_ptr->m_Size, &desc.m_DepthSize, sizeof(cb_ptr->m_Size));
-    memcpy(&cb_ptr->m_Viewer, &desc.m_Viewer, sizeof(cb_ptr->m_Viewer));
-    cb_ptr->m_SizeInv.x = 1.0f / desc.m_DepthSize.x;
-    cb_ptr->m_SizeInv.y = 1.0f / desc.m_DepthSize.y;
-
-    for (uint i = 0; i < desc.m_ActiveLightCount; i++)
     {
-        float2 shadowSizeInv ={1.0f / cb_ptr->m_Light[i].m_Size.x, 1.0f / cb_ptr->m_Light[i].m_Size.y};
-
-        memcpy(&cb_ptr->m_Light[i].m_Camera, &desc.m_Light[i], sizeof(cb_ptr->m_Light[i].m_Camera));
-        memcpy(&cb_ptr->m_Light[i].m_Size, &desc.m_ShadowSize[i], sizeof(cb_ptr->m_Light[i].m_Size));
-        memcpy(&cb_ptr->m_Light[i].m_SizeInv, &shadowSizeInv, sizeof(shadowSizeInv));
-        memcpy(&cb_ptr->m_Light[i].m_Region, &desc.m_ShadowRegion[i], sizeof(cb_ptr->m_Light[i].m_Region));
-        memcpy(&cb_ptr->m_Light[i].m_SunArea, &desc.m_SunArea[i], sizeof(cb_ptr->m_Light[i].m_SunArea));
-        memcpy(&cb_ptr->m_Light[i].m_DepthTestOffset, &desc.m_DepthTestOffset[i], sizeof(cb_ptr->m_Light[i].m_DepthTestOffset));
-        memcpy(&cb_ptr->m_Light[i].m_NormalOffsetScale, &desc.m_NormalOffsetScale[i], sizeof(cb_ptr->m_Light[i].m_NormalOffsetScale));
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX constant buffer");
+        cb_ptr->m_ActiveLightCount = desc.m_ActiveLightCount;
+        memcpy(&cb_ptr->m_Size, &desc.m_DepthSize, sizeof(cb_ptr->m_Size));
+        memcpy(&cb_ptr->m_Viewer, &desc.m_Viewer, sizeof(cb_ptr->m_Viewer));
+        cb_ptr->m_SizeInv.x = 1.0f / desc.m_DepthSize.x;
+        cb_ptr->m_SizeInv.y = 1.0f / desc.m_DepthSize.y;
+
+        for (uint i = 0; i < desc.m_ActiveLightCount; i++)
+        {
+            float2 shadowSizeInv ={1.0f / cb_ptr->m_Light[i].m_Size.x, 1.0f / cb_ptr->m_Light[i].m_Size.y};
+
+            memcpy(&cb_ptr->m_Light[i].m_Camera, &desc.m_Light[i], sizeof(cb_ptr->m_Light[i].m_Camera));
+            memcpy(&cb_ptr->m_Light[i].m_Size, &desc.m_ShadowSize[i], sizeof(cb_ptr->m_Light[i].m_Size));
+            memcpy(&cb_ptr->m_Light[i].m_SizeInv, &shadowSizeInv, sizeof(shadowSizeInv));
+            memcpy(&cb_ptr->m_Light[i].m_Region, &desc.m_ShadowRegion[i], sizeof(cb_ptr->m_Light[i].m_Region));
+            memcpy(&cb_ptr->m_Light[i].m_SunArea, &desc.m_SunArea[i], sizeof(cb_ptr->m_Light[i].m_SunArea));
+            memcpy(&cb_ptr->m_Light[i].m_DepthTestOffset, &desc.m_DepthTestOffset[i], sizeof(cb_ptr->m_Light[i].m_DepthTestOffset));
+            memcpy(&cb_ptr->m_Light[i].m_NormalOffsetScale, &desc.m_NormalOffsetScale[i], sizeof(cb_ptr->m_Light[i].m_NormalOffsetScale));
+
+            cb_ptr->m_Light[i].m_ArraySlice = desc.m_ArraySlice[i];
+            cb_ptr->m_Light[i].m_Weight.x = desc.m_Weight[i];
+            cb_ptr->m_Light[i].m_Weight.y = desc.m_TextureType == SHADOWFX_TEXTURE_2D_ARRAY && desc.m_ShadowWrap[i] ? 1.0f : 0.0f;
+        }
 
-        cb_ptr->m_Light[i].m_ArraySlice = desc.m_ArraySlice[i];
-        cb_ptr->m_Light[i].m_Weight.x = desc.m_Weight[i];
+        ++m_num_cb_upload;
+        m_cb_upload_bytes += sizeof(ShadowsData);
     }
 
     // bind srd
@@ -531,12 +763,44 @@ SHADOWFX_RETURN_CODE ShadowFX_OpaqueDesc::render(const ShadowFX_Desc & desc)
     cl->SetDescriptorHeaps(1, heaps);
     cl->SetGraphicsRootDescriptorTable(0, get_gpu_handle(m_srd_heap, inst_id * m_num_srd_heap_slot + 0));
 
+    // the timestamps of this call go to the next slot of its instance, overwriting the call made m_StatsLatency + 1 calls earlier
+    // getStats reads them once the application fence reaches m_StatsFenceValue
+    shadowfx_stats_instance* stats = m_stats_query_heap != nullptr ? &m_stats_instance[inst_id] : nullptr;
+    std::size_t stats_slot = 0;
+    UINT stats_query = 0;
+    if (stats != nullptr)
+    {
+        stats_slot = stats->num_call % shadowfx_stats_instance::num_slot;
+        stats_query = static_cast<UINT>(2 * (inst_id * shadowfx_stats_instance::num_slot + stats_slot));
+        cl->EndQuery(m_stats_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, stats_query);
+    }
+
     // draw
     cl->IASetVertexBuffers(0, 0, nullptr);
     cl->IASetIndexBuffer(nullptr);
     cl->DrawInstanced(3, 1, 0, 0);
 
-    return SHADOWFX_RETURN_CODE_SUCCESS;
+    if (stats != nullptr)
+    {
+        cl->EndQuery(m_stats_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, stats_query + 1);
+        cl->ResolveQueryData(m_stats_query_heap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, stats_query, 2, m_stats_readback.Get(), stats_query * sizeof(std::uint64_t));
+
+        auto& call = stats->call[stats_slot];
+        call.m_GpuTimeRenderIndex = render_index;
+        call.m_GpuPassCount = 1;
+        ShadowFX_SetStatsPermutation(call, desc);
+        stats->fence[stats_slot] = desc.m_StatsFenceValue;
+        ++stats->num_call;
+    }
+
+    if (desc.m_EnableCapture)
+    {
+        SHADOWFX_PROFILE_SCOPE(desc, "ShadowFX capture");
+        return capture(desc, render_index);
+    }
+
+    // the first call made after a capture writes its buffered records
+    return flushCapture();
 }
 
 }
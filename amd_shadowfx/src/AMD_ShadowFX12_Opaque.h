@@ -26,8 +26,13 @@
 #include "AMD_ShadowFX.h"
 #include <wrl/client.h>
 #include <d3dx12.h>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #pragma warning( disable : 4996 ) // disable stdio deprecated message
 
@@ -40,6 +45,7 @@ struct shadowfx_pipeline_state_object
 {
     Microsoft::WRL::ComPtr<ID3D12PipelineState> pso{};
     D3D12_GRAPHICS_PIPELINE_STATE_DESC pso_desc = {};
+    std::atomic<ID3D12PipelineState*> ready{ nullptr }; // pso once it is created, read without a lock by render
 };
 
 // structure holding a descriptor heap. The number of slots in the heap and the size of one descriptor
@@ -50,6 +56,16 @@ struct shadowfx_descriptor_heap
     std::size_t slot_size = 0; // slot size
 };
 
+// timed calls of one instance. The last ShadowFX_Desc::m_StatsLatency + 1 calls keep their timestamps in the readback buffer
+// a slot is only read once the application fence has reached the value given with its call
+struct shadowfx_stats_instance
+{
+    static std::size_t const num_slot = ShadowFX_Desc::m_StatsLatency + 1;
+    std::uint32_t num_call = 0; // timed calls made with this instance
+    ShadowFX_Stats call[num_slot] = {}; // render index, pass count and permutation of the call in each slot
+    std::uint64_t fence[num_slot] = {}; // ShadowFX_Desc::m_StatsFenceValue of the call in each slot, 0 if unknown
+};
+
 struct ShadowFX_OpaqueDesc
 {
 public:
@@ -72,7 +88,7 @@ public:
             float2                               m_SizeInv;
             float4                               m_Region;
 
-            float4                               m_Weight;
+            float4                               m_Weight; // .x weight, .y 1 for a wrapped array slice
 
             float                                m_SunArea;
             float                                m_DepthTestOffset;
@@ -110,15 +126,38 @@ public:
 
     shadowfx_pipeline_state_object  psoShadowPointDebugT2D[SHADOWFX_EXECUTION_COUNT][SHADOWFX_NORMAL_OPTION_COUNT];
     shadowfx_pipeline_state_object  psoShadowPointDebugT2DA[SHADOWFX_EXECUTION_COUNT][SHADOWFX_NORMAL_OPTION_COUNT];
+    std::mutex                       m_pso_mutex; // guards the lazy PSO creation of instances rendering in parallel, only taken until a PSO is ready
+
+    // statistics counters. Instances may render in parallel
+    std::atomic<std::uint32_t> m_num_render{ 0 };
+    std::atomic<std::uint32_t> m_num_pso_created{ 0 };
+    std::atomic<std::uint32_t> m_num_cb_upload{ 0 };
+    std::atomic<std::uint64_t> m_cb_upload_bytes{ 0 };
+
+    // gpu timing of render (m_EnableStats): a begin/end timestamp pair per slot of each instance, resolved to a readback buffer
+    Microsoft::WRL::ComPtr<ID3D12QueryHeap> m_stats_query_heap{};
+    Microsoft::WRL::ComPtr<ID3D12Resource> m_stats_readback{};
+    std::vector<shadowfx_stats_instance> m_stats_instance;
+
+    // capture of render (m_EnableCapture): the parameters of the calls are appended to a file kept open while its name doesn't change
+    // the textures are not captured, they are only readable once the application has executed the command list
+    std::mutex m_capture_mutex; // instances may render in parallel
+    std::FILE* m_capture_file = nullptr;
+    std::string m_capture_file_name;
+    std::atomic<bool> m_capture_pending{ false }; // records buffered since the last flush, checked without the lock by calls that don't capture
 
     ShadowFX_OpaqueDesc(const ShadowFX_Desc & desc);
     ~ShadowFX_OpaqueDesc();
 
     SHADOWFX_RETURN_CODE                         cbInitialize(const ShadowFX_Desc & desc);
     SHADOWFX_RETURN_CODE                         createPSO(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         createStats(const ShadowFX_Desc & desc);
     SHADOWFX_RETURN_CODE                         init(const ShadowFX_Desc & desc);
 
     SHADOWFX_RETURN_CODE                         render(const ShadowFX_Desc & desc);
+    SHADOWFX_RETURN_CODE                         getStats(const ShadowFX_Desc & desc, ShadowFX_Stats & stats);
+    SHADOWFX_RETURN_CODE                         capture(const ShadowFX_Desc & desc, std::uint32_t render_index);
+    SHADOWFX_RETURN_CODE                         flushCapture();
 
     void                                         release();
 };
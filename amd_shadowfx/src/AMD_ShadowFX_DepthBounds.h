@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_SHADOWFX_DEPTH_BOUNDS_H
+#define AMD_SHADOWFX_DEPTH_BOUNDS_H
+
+#include "AMD_ShadowFX.h"
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+namespace AMD
+{
+
+// Depth bounds are reduced as uints: a float is mapped to a uint with the same ordering and maxima are stored inverted,
+// so every slot is reduced with InterlockedMin and cleared to SHADOWFX_DEPTH_BOUNDS_EMPTY (see shadowDepthBounds).
+// The slots are the view depth min and max followed by the receiver min (xyz) and max (xyz) of each light
+static const uint SHADOWFX_DEPTH_BOUNDS_COUNT = 2 + 6 * ShadowFX_Desc::m_MaxLightCount;
+static const uint SHADOWFX_DEPTH_BOUNDS_EMPTY = 0xffffffff;
+
+inline uint ShadowFX_OrderedFloat(float value)
+{
+    uint bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+inline float ShadowFX_OrderedFloatInv(uint ordered)
+{
+    uint bits = (ordered & 0x80000000) ? (ordered & 0x7fffffff) : ~ordered;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float ShadowFX_DecodeDepthBoundsMin(uint slot)
+{
+    return slot == SHADOWFX_DEPTH_BOUNDS_EMPTY ? FLT_MAX : ShadowFX_OrderedFloatInv(slot);
+}
+
+inline float ShadowFX_DecodeDepthBoundsMax(uint slot)
+{
+    return slot == SHADOWFX_DEPTH_BOUNDS_EMPTY ? -FLT_MAX : ShadowFX_OrderedFloatInv(~slot);
+}
+
+// converts SHADOWFX_DEPTH_BOUNDS_COUNT reduced slots, read back from the GPU or reduced on the CPU
+inline void ShadowFX_DecodeDepthBounds(const uint * pSlots, ShadowFX_DepthBounds & bounds)
+{
+    bounds.m_MinDepth = ShadowFX_DecodeDepthBoundsMin(pSlots[0]);
+    bounds.m_MaxDepth = ShadowFX_DecodeDepthBoundsMax(pSlots[1]);
+
+    for (uint light = 0; light < ShadowFX_Desc::m_MaxLightCount; light++)
+    {
+        const uint * pLight = pSlots + 2 + 6 * light;
+        for (uint c = 0; c < 3; c++)
+        {
+            bounds.m_ReceiverMin[light].v[c] = ShadowFX_DecodeDepthBoundsMin(pLight[c]);
+            bounds.m_ReceiverMax[light].v[c] = ShadowFX_DecodeDepthBoundsMax(pLight[3 + c]);
+        }
+    }
+}
+
+// transforms with the ShadowFX matrix layout, the same as mul(v, m) in the shaders
+inline void ShadowFX_TransformDepthBounds(const float * m, const float v[4], float out[4])
+{
+    for (int r = 0; r < 4; r++)
+    {
+        out[r] = m[r * 4 + 0] * v[0] + m[r * 4 + 1] * v[1] + m[r * 4 + 2] * v[2] + m[r * 4 + 3] * v[3];
+    }
+}
+
+// CPU reference of the depth bounds reduction shared by the DX11 and DX12 ShadowFX_ReduceDepthBoundsCPU. It only reads the
+// API independent members of the descriptor and gives the same result as the shadowDepthBounds compute shader
+inline SHADOWFX_RETURN_CODE ShadowFX_ReduceDepthBoundsReference(const ShadowFX_Desc & desc, const float * pDepth, uint rowPitch, ShadowFX_DepthBounds & bounds)
+{
+    uint width = (uint)desc.m_DepthSize.x;
+    uint height = (uint)desc.m_DepthSize.y;
+
+    if (width == 0 || height == 0 || rowPitch < width * sizeof(float) ||
+        desc.m_ActiveLightCount > ShadowFX_Desc::m_MaxLightCount)
+    {
+        return SHADOWFX_RETURN_CODE_INVALID_ARGUMENT;
+    }
+
+    uint slots[SHADOWFX_DEPTH_BOUNDS_COUNT];
+    for (uint i = 0; i < SHADOWFX_DEPTH_BOUNDS_COUNT; i++)
+    {
+        slots[i] = SHADOWFX_DEPTH_BOUNDS_EMPTY;
+    }
+
+    for (uint y = 0; y < height; y++)
+    {
+        const float * pRow = (const float *)((const char *)pDepth + y * rowPitch);
+
+        for (uint x = 0; x < width; x++)
+        {
+            float depth = pRow[x];
+            if (!(depth < 1.0f)) continue;
+
+            float vs[4];
+            float cs[4] ={0.0f, 0.0f, depth, 1.0f};
+            ShadowFX_TransformDepthBounds(desc.m_Viewer.m_Projection_Inv.m, cs, vs);
+            uint viewDepth = ShadowFX_OrderedFloat(fabsf(vs[2] / vs[3]));
+            slots[0] = viewDepth < slots[0] ? viewDepth : slots[0];
+            slots[1] = ~viewDepth < slots[1] ? ~viewDepth : slots[1];
+
+            float ws[4];
+            cs[0] = ((x + 0.5f) / desc.m_DepthSize.x - 0.5f) * 2.0f;
+            cs[1] = (0.5f - (y + 0.5f) / desc.m_DepthSize.y) * 2.0f;
+            ShadowFX_TransformDepthBounds(desc.m_Viewer.m_ViewProjection_Inv.m, cs, ws);
+            for (int c = 0; c < 3; c++) ws[c] /= ws[3];
+            ws[3] = 1.0f;
+
+            uint first = 0;
+            uint last = desc.m_ActiveLightCount;
+            if (desc.m_Execution == SHADOWFX_EXECUTION_CUBE)
+            {
+                // same face selection as transformWorldPositionToCubeFace
+                float dir[3] ={ws[0] - desc.m_Light[0].m_Position.x, ws[1] - desc.m_Light[0].m_Position.y, ws[2] - desc.m_Light[0].m_Position.z};
+                float maxAxis = std::max(fabsf(dir[0]), std::max(fabsf(dir[1]), fabsf(dir[2])));
+                if (maxAxis == fabsf(dir[0])) first = dir[0] > 0 ? 0 : 1;
+                if (maxAxis == fabsf(dir[1])) first = dir[1] > 0 ? 2 : 3;
+                if (maxAxis == fabsf(dir[2])) first = dir[2] > 0 ? 4 : 5;
+                last = first + 1;
+            }
+
+            for (uint light = first; light < last; light++)
+            {
+                float ls[4];
+                ShadowFX_TransformDepthBounds(desc.m_Light[light].m_ViewProjection.m, ws, ls);
+                float receiver[3] ={ls[0] / ls[3] * 0.5f + 0.5f, 0.5f - ls[1] / ls[3] * 0.5f, ls[2] / ls[3]};
+
+                if (receiver[0] < 0.0f || receiver[0] > 1.0f ||
+                    receiver[1] < 0.0f || receiver[1] > 1.0f ||
+                    receiver[2] < 0.0f || receiver[2] > 1.0f)
+                {
+                    continue;
+                }
+
+                uint * pLight = slots + 2 + 6 * light;
+                for (int c = 0; c < 3; c++)
+                {
+                    uint ordered = ShadowFX_OrderedFloat(receiver[c]);
+                    pLight[c] = ordered < pLight[c] ? ordered : pLight[c];
+                    pLight[3 + c] = ~ordered < pLight[3 + c] ? ~ordered : pLight[3 + c];
+                }
+
+                if (desc.m_Execution == SHADOWFX_EXECUTION_CASCADE) break;
+            }
+        }
+    }
+
+    ShadowFX_DecodeDepthBounds(slots, bounds);
+
+    return SHADOWFX_RETURN_CODE_SUCCESS;
+}
+
+}
+
+#endif // AMD_SHADOWFX_DEPTH_BOUNDS_H
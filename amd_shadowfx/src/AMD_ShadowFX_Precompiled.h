@@ -22,6 +22,10 @@
 
 #pragma once
 
+// PS_SF_T2D_Data and PS_SF_T2DA_Data only hold the FIXED and POISSON tap types
+// POISSON_ROTATED permutations are stored in the separate PS_SF_T2D_ROTATED_Data and PS_SF_T2DA_ROTATED_Data arrays below
+static const int PS_SF_TAP_TYPE_COUNT = AMD::SHADOWFX_TAP_TYPE_POISSON_ROTATED;
+
 #include "Shaders\inc\VS_FULLSCREEN.inc"
 
 // Shaders: Pixel Shader Shadow Filtering Texture2D Point shader permutations
@@ -1864,6 +1868,9 @@ int PS_SF_T2D_POINT_Size[] = {
 
 /* --------------------------------------------------------------------------------------------- */
 
+// Shaders: Texture2D Array shader permutations
+// Generated by Shaders\build\fxc_compile_all_filtering.bat, the pre-build step runs it when the headers are missing
+
 // Shaders: Pixel Shader Shadow Filtering Texture2D Array Point shader permutations
 
 #include "Shaders\inc\PS_SF_T2DA_POINT_NORMAL_OPTION_NONE.inc"
@@ -3704,3 +3711,3488 @@ int PS_SF_T2DA_POINT_Size[] = {
   sizeof(PS_SF_T2DA_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data),
   sizeof(PS_SF_T2DA_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV_Data),
 };
+
+// Shaders: Rotated poisson shader permutations and the shadow mask denoise pass
+// Generated by Shaders\build\fxc_compile_rotated_poisson_filtering.bat
+// Arrays are indexed [filtering][execution][texture fetch][normal option][filter size]
+// The pre-build step runs the script when the headers are missing
+
+#include "Shaders\inc\PS_SF_DENOISE.inc"
+
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+
+const BYTE * PS_SF_T2D_ROTATED_Data[] = {
+  /* Uniform Union */
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cascade */
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cube */
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Weighted Avg */
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Union */
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cascade */
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cube */
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Weighted Avg */
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+};
+
+int   PS_SF_T2D_ROTATED_Size[] = {
+  /* Uniform Union */
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cascade */
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cube */
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Weighted Avg */
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Union */
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cascade */
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cube */
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Weighted Avg */
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2D_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+};
+
+const BYTE * PS_SF_T2DA_ROTATED_Data[] = {
+  /* Uniform Union */
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cascade */
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cube */
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Weighted Avg */
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Union */
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cascade */
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cube */
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Weighted Avg */
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+};
+
+int   PS_SF_T2DA_ROTATED_Size[] = {
+  /* Uniform Union */
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cascade */
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cube */
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Weighted Avg */
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Union */
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cascade */
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cube */
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Weighted Avg */
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+};
+
+// Shaders: Virtual shadow map shader permutations and the page feedback pass
+// Generated by Shaders\build\fxc_compile_virtual_filtering.bat
+// PS_SF_T2DV_Data is indexed like PS_SF_T2D_Data, PS_SF_EXEC_FEEDBACK_Data is indexed [execution]
+// The pre-build step runs the script when the headers are missing
+
+#include "Shaders\inc\PS_SF_FEEDBACK.inc"
+#include "Shaders\inc\PS_SF_CASCADE_FEEDBACK.inc"
+#include "Shaders\inc\PS_SF_CUBE_FEEDBACK.inc"
+#include "Shaders\inc\PS_SF_AVG_FEEDBACK.inc"
+
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc"
+
+#include "Shaders\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_NONE.inc"
+#include "Shaders\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc"
+#include "Shaders\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_READ_FROM_SRV.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_NONE.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc"
+#include "Shaders\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_READ_FROM_SRV.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_NONE.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc"
+#include "Shaders\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_READ_FROM_SRV.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_NONE.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc"
+#include "Shaders\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV.inc"
+
+const BYTE * PS_SF_T2DV_Data[] = {
+  /* Uniform Union */
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cascade */
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Cube */
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Uniform Weighted Avg */
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Union */
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cascade */
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Cube */
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  /* Contact Weighted Avg */
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data,
+
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data,
+  PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data,
+
+};
+
+int   PS_SF_T2DV_Size[] = {
+  /* Uniform Union */
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cascade */
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Cube */
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Uniform Weighted Avg */
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Union */
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cascade */
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Cube */
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  /* Contact Weighted Avg */
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data),
+
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data),
+  sizeof(PS_SF_T2DV_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data),
+
+};
+
+const BYTE * PS_SF_T2DV_POINT_Data[] = {
+  PS_SF_T2DV_POINT_NORMAL_OPTION_NONE_Data,
+  PS_SF_T2DV_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data,
+  PS_SF_T2DV_POINT_NORMAL_OPTION_READ_FROM_SRV_Data,
+
+  PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_NONE_Data,
+  PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data,
+  PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data,
+
+  PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_NONE_Data,
+  PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data,
+  PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data,
+
+  PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_NONE_Data,
+  PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data,
+  PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV_Data,
+};
+
+int PS_SF_T2DV_POINT_Size[] = {
+  sizeof(PS_SF_T2DV_POINT_NORMAL_OPTION_NONE_Data),
+  sizeof(PS_SF_T2DV_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data),
+  sizeof(PS_SF_T2DV_POINT_NORMAL_OPTION_READ_FROM_SRV_Data),
+
+  sizeof(PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_NONE_Data),
+  sizeof(PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data),
+  sizeof(PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data),
+
+  sizeof(PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_NONE_Data),
+  sizeof(PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data),
+  sizeof(PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data),
+
+  sizeof(PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_NONE_Data),
+  sizeof(PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data),
+  sizeof(PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV_Data),
+};
+
+const BYTE * PS_SF_EXEC_FEEDBACK_Data[] = {
+  PS_SF_FEEDBACK_Data,
+  PS_SF_CASCADE_FEEDBACK_Data,
+  PS_SF_CUBE_FEEDBACK_Data,
+  PS_SF_AVG_FEEDBACK_Data,
+};
+
+int PS_SF_EXEC_FEEDBACK_Size[] = {
+  sizeof(PS_SF_FEEDBACK_Data),
+  sizeof(PS_SF_CASCADE_FEEDBACK_Data),
+  sizeof(PS_SF_CUBE_FEEDBACK_Data),
+  sizeof(PS_SF_AVG_FEEDBACK_Data),
+};
+
+// Shaders: Depth bounds reduction
+// Generated by Shaders\build\fxc_compile_depth_bounds.bat
+// CS_SF_EXEC_DEPTH_BOUNDS_Data is indexed [execution]
+// The pre-build step runs the script when the headers are missing
+
+#include "Shaders\inc\CS_SF_DEPTH_BOUNDS.inc"
+#include "Shaders\inc\CS_SF_CASCADE_DEPTH_BOUNDS.inc"
+#include "Shaders\inc\CS_SF_CUBE_DEPTH_BOUNDS.inc"
+#include "Shaders\inc\CS_SF_AVG_DEPTH_BOUNDS.inc"
+
+const BYTE * CS_SF_EXEC_DEPTH_BOUNDS_Data[] = {
+  CS_SF_DEPTH_BOUNDS_Data,
+  CS_SF_CASCADE_DEPTH_BOUNDS_Data,
+  CS_SF_CUBE_DEPTH_BOUNDS_Data,
+  CS_SF_AVG_DEPTH_BOUNDS_Data,
+};
+
+int CS_SF_EXEC_DEPTH_BOUNDS_Size[] = {
+  sizeof(CS_SF_DEPTH_BOUNDS_Data),
+  sizeof(CS_SF_CASCADE_DEPTH_BOUNDS_Data),
+  sizeof(CS_SF_CUBE_DEPTH_BOUNDS_Data),
+  sizeof(CS_SF_AVG_DEPTH_BOUNDS_Data),
+};
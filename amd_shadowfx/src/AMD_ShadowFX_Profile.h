@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2016 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+
+#ifndef AMD_SHADOWFX_PROFILE_H
+#define AMD_SHADOWFX_PROFILE_H
+
+#include "AMD_ShadowFX.h"
+#include <stdio.h>
+#include <string.h>
+
+namespace AMD
+{
+
+// opens a zone of the application profiler (ShadowFX_Desc::m_pProfiler) for the lifetime of the object
+// it does nothing when no profiler is set, so the library keeps no dependency on the application profiler
+class ShadowFX_ProfileScope
+{
+public:
+    ShadowFX_ProfileScope(const ShadowFX_Desc & desc, const char * name)
+        : m_pProfiler(desc.m_pProfiler != NULL && desc.m_pProfiler->m_pBegin != NULL && desc.m_pProfiler->m_pEnd != NULL ? desc.m_pProfiler : NULL)
+    {
+        if (m_pProfiler != NULL)
+            m_pProfiler->m_pBegin(name, m_pProfiler->m_pUserData);
+    }
+
+    ~ShadowFX_ProfileScope()
+    {
+        if (m_pProfiler != NULL)
+            m_pProfiler->m_pEnd(m_pProfiler->m_pUserData);
+    }
+
+private:
+    ShadowFX_ProfileScope(const ShadowFX_ProfileScope &);
+    ShadowFX_ProfileScope & operator= (const ShadowFX_ProfileScope &);
+
+    const ShadowFX_Profiler* m_pProfiler;
+};
+
+// the permutation of a call is recorded with its GPU timestamps, so ShadowFX_GetStats reports the shader that was timed
+inline void ShadowFX_SetStatsPermutation(ShadowFX_Stats & stats, const ShadowFX_Desc & desc)
+{
+    stats.m_Execution = desc.m_Execution;
+    stats.m_TextureType = desc.m_TextureType;
+    stats.m_TextureFetch = desc.m_TextureFetch;
+    stats.m_Filtering = desc.m_Filtering;
+    stats.m_TapType = desc.m_TapType;
+    stats.m_FilterSize = desc.m_FilterSize;
+    stats.m_NormalOption = desc.m_NormalOption;
+}
+
+// copies the GPU time of a resolved call and the permutation it used into the statistics returned by ShadowFX_GetStats
+inline void ShadowFX_SetStatsGpuTime(ShadowFX_Stats & stats, const ShadowFX_Stats & call, float time)
+{
+    stats.m_GpuTimeRenderIndex = call.m_GpuTimeRenderIndex;
+    stats.m_GpuPassCount = call.m_GpuPassCount;
+    stats.m_GpuTime = time;
+    stats.m_Execution = call.m_Execution;
+    stats.m_TextureType = call.m_TextureType;
+    stats.m_TextureFetch = call.m_TextureFetch;
+    stats.m_Filtering = call.m_Filtering;
+    stats.m_TapType = call.m_TapType;
+    stats.m_FilterSize = call.m_FilterSize;
+    stats.m_NormalOption = call.m_NormalOption;
+}
+
+// capture records are written through a large stdio buffer instead of being flushed with every call. The buffer is flushed
+// when it fills up, when a call is made with m_EnableCapture cleared and when the file is closed
+static const size_t SHADOWFX_CAPTURE_BUFFER_SIZE = 1 << 20;
+
+// opens a capture stream for appending, NULL on failure
+inline FILE* ShadowFX_OpenCaptureFile(const char * name)
+{
+    FILE* file = fopen(name, "ab");
+    if (file != NULL)
+    {
+        setvbuf(file, NULL, _IOFBF, SHADOWFX_CAPTURE_BUFFER_SIZE);
+    }
+    return file;
+}
+
+// fills the API independent part of a capture record. The cameras and vectors have the same layout in both structures
+inline void ShadowFX_SetCaptureCall(ShadowFX_CaptureCall & call, const ShadowFX_Desc & desc, uint api, uint renderIndex, uint instanceID)
+{
+    static_assert(sizeof(call.m_Viewer) == sizeof(desc.m_Viewer), "ShadowFX_CaptureCall::Camera must match ShadowFX_Desc::Camera");
+    static_assert(SHADOWFX_CAPTURE_MAX_LIGHT_COUNT == ShadowFX_Desc::m_MaxLightCount, "ShadowFX_CaptureCall must hold every light");
+
+    memset(&call, 0, sizeof(call));
+    call.m_Magic = SHADOWFX_CAPTURE_MAGIC;
+    call.m_Version = SHADOWFX_CAPTURE_VERSION;
+    call.m_Size = sizeof(call);
+    call.m_Api = api;
+    call.m_RenderIndex = renderIndex;
+    call.m_InstanceID = instanceID;
+
+    call.m_Execution = desc.m_Execution;
+    call.m_Implementation = desc.m_Implementation;
+    call.m_TextureType = desc.m_TextureType;
+    call.m_TextureFetch = desc.m_TextureFetch;
+    call.m_Filtering = desc.m_Filtering;
+    call.m_TapType = desc.m_TapType;
+    call.m_FilterSize = desc.m_FilterSize;
+    call.m_NormalOption = desc.m_NormalOption;
+    call.m_OutputFormat = desc.m_OutputFormat;
+    call.m_ActiveLightCount = desc.m_ActiveLightCount;
+
+    memcpy(&call.m_Viewer, &desc.m_Viewer, sizeof(call.m_Viewer));
+    memcpy(&call.m_DepthSize, &desc.m_DepthSize, sizeof(call.m_DepthSize));
+    memcpy(call.m_Light, desc.m_Light, sizeof(call.m_Light));
+    memcpy(call.m_ShadowSize, desc.m_ShadowSize, sizeof(call.m_ShadowSize));
+    memcpy(call.m_ShadowRegion, desc.m_ShadowRegion, sizeof(call.m_ShadowRegion));
+    memcpy(call.m_SunArea, desc.m_SunArea, sizeof(call.m_SunArea));
+    memcpy(call.m_DepthTestOffset, desc.m_DepthTestOffset, sizeof(call.m_DepthTestOffset));
+    memcpy(call.m_NormalOffsetScale, desc.m_NormalOffsetScale, sizeof(call.m_NormalOffsetScale));
+    memcpy(call.m_Weight, desc.m_Weight, sizeof(call.m_Weight));
+    memcpy(call.m_ArraySlice, desc.m_ArraySlice, sizeof(call.m_ArraySlice));
+    for (uint i = 0; i < SHADOWFX_CAPTURE_MAX_LIGHT_COUNT; i++)
+    {
+        call.m_ShadowWrap[i] = desc.m_ShadowWrap[i] ? 1 : 0;
+    }
+}
+
+}
+
+#define SHADOWFX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define SHADOWFX_PROFILE_CONCAT(a, b) SHADOWFX_PROFILE_CONCAT_IMPL(a, b)
+
+// profile the rest of the enclosing block
+#define SHADOWFX_PROFILE_SCOPE(desc, name) AMD::ShadowFX_ProfileScope SHADOWFX_PROFILE_CONCAT(shadowfx_profile_scope_, __LINE__)(desc, name)
+
+#endif // AMD_SHADOWFX_PROFILE_H
@@ -116,6 +116,14 @@ PS_ShadowMaskOutput shadowFiltering( PS_FullscreenInput I )
 #   elif (AMD_SHADOWFX_TEXTURE_FETCH == AMD_SHADOWFX_TEXTURE_FETCH_PCF) // pcf
       filteredShadow = uniformPoissonPCF( shadow_space_pos.xyz, g_cbShadowsData.m_Light[active] );
 #   endif
+
+# elif (AMD_SHADOWFX_TAP_TYPE == AMD_SHADOWFX_TAP_TYPE_POISSON_ROTATED)
+
+#   if (AMD_SHADOWFX_TEXTURE_FETCH == AMD_SHADOWFX_TEXTURE_FETCH_GATHER4) // gather4
+      filteredShadow = uniformRotatedPoissonGather4( shadow_space_pos.xyz, I.position.xy, g_cbShadowsData.m_Light[active] );
+#   elif (AMD_SHADOWFX_TEXTURE_FETCH == AMD_SHADOWFX_TEXTURE_FETCH_PCF) // pcf
+      filteredShadow = uniformRotatedPoissonPCF( shadow_space_pos.xyz, I.position.xy, g_cbShadowsData.m_Light[active] );
+#   endif
 # endif
 
 #elif (AMD_SHADOWFX_FILTERING == AMD_SHADOWFX_FILTERING_CONTACT)
@@ -136,6 +144,14 @@ PS_ShadowMaskOutput shadowFiltering( PS_FullscreenInput I )
       filteredShadow = contactPoissonPCF(shadow_space_pos.xyz, g_cbShadowsData.m_Light[active]); // not yet implemented
 #   endif
 
+# elif (AMD_SHADOWFX_TAP_TYPE == AMD_SHADOWFX_TAP_TYPE_POISSON_ROTATED)
+
+#   if (AMD_SHADOWFX_TEXTURE_FETCH == AMD_SHADOWFX_TEXTURE_FETCH_GATHER4)
+      filteredShadow = contactRotatedPoissonGather4(shadow_space_pos.xyz, I.position.xy, g_cbShadowsData.m_Light[active]);
+#   elif (AMD_SHADOWFX_TEXTURE_FETCH == AMD_SHADOWFX_TEXTURE_FETCH_PCF) // pcf
+      filteredShadow = contactRotatedPoissonPCF(shadow_space_pos.xyz, I.position.xy, g_cbShadowsData.m_Light[active]);
+#   endif
+
 # endif
 
 #elif (AMD_SHADOWFX_FILTERING == AMD_SHADOWFX_FILTERING_DEBUG_POINT)
@@ -162,6 +178,232 @@ PS_ShadowMaskOutput shadowFiltering( PS_FullscreenInput I )
   return O;
 }
 
+//--------------------------------------------------------------------------------------
+// SHADOW MASK DENOISE
+//--------------------------------------------------------------------------------------
+
+float calculateViewSpaceDepth(float depth)
+{
+  float4 vs_position = mul(float4(0.0f, 0.0f, depth, 1.0f), g_cbShadowsData.m_Viewer.m_Projection_Inv);
+  return vs_position.z / vs_position.w;
+}
+
+// Edge aware 5x5 filter resolving the noise of the rotated poisson taps.
+// Neighbours are weighted by distance and by their view depth difference relative to the center,
+// so the mask is not blurred across depth discontinuities
+PS_ShadowMaskOutput shadowDenoise( PS_FullscreenInput I )
+{
+  PS_ShadowMaskOutput O;
+
+  int2 center = int2( I.position.xy );
+  int2 maxCoord = int2( g_cbShadowsData.m_Size ) - int2( 1, 1 );
+  float centerDepth = calculateViewSpaceDepth( g_t2dDepth.Load( int3( center, 0 ) ).x );
+  float depthScale = 1.0f / max( abs( centerDepth ) * AMD_SHADOWFX_DENOISE_DEPTH_SIGMA, 1e-6f );
+
+  float accumulatedShadow = 0.0f;
+  float accumulatedWeight = 0.0f;
+
+  [unroll]for( int row = -AMD_SHADOWFX_DENOISE_RADIUS; row <= AMD_SHADOWFX_DENOISE_RADIUS; row++ )
+  {
+    [unroll]for( int col = -AMD_SHADOWFX_DENOISE_RADIUS; col <= AMD_SHADOWFX_DENOISE_RADIUS; col++ )
+    {
+      int2 coord = clamp( center + int2( col, row ), int2( 0, 0 ), maxCoord );
+      float depth = calculateViewSpaceDepth( g_t2dDepth.Load( int3( coord, 0 ) ).x );
+
+      float weight = exp( -float( col*col + row*row ) / ( 2.0f * AMD_SHADOWFX_DENOISE_RADIUS * AMD_SHADOWFX_DENOISE_RADIUS ) );
+      weight *= exp( -abs( depth - centerDepth ) * depthScale );
+
+      accumulatedShadow += g_t2dShadowMask.Load( int3( coord, 0 ) ).x * weight;
+      accumulatedWeight += weight;
+    }
+  }
+
+  O.shadow = ( accumulatedShadow / accumulatedWeight ).xxxx;
+
+  return O;
+}
+
+//--------------------------------------------------------------------------------------
+// VIRTUAL SHADOW MAP PAGE FEEDBACK
+//--------------------------------------------------------------------------------------
+
+float4 calculateWorldSpacePositionFromPixel(int2 pixel)
+{
+  int2 coord = clamp( pixel, int2( 0, 0 ), int2( g_cbShadowsData.m_Size ) - int2( 1, 1 ) );
+  float4 clip_space_position;
+  clip_space_position.xy = ((coord + 0.5f) * float2(g_cbShadowsData.m_SizeInv.x, -g_cbShadowsData.m_SizeInv.y) - float2(0.5, -0.5))*2.0;
+  clip_space_position.z = g_t2dDepth.Load( int3( coord, 0 ) ).x;
+  clip_space_position.w = 1.0;
+  return calculateWorldSpacePosition(clip_space_position);
+}
+
+float2 calculateShadowSpaceUV(float4 ws_position, ShadowsLightData lightData)
+{
+  float4 shadow_space_pos = calculateShadowSpacePosition(ws_position, lightData);
+  return float2(shadow_space_pos.x * 0.5 + 0.5, 0.5 - shadow_space_pos.y * 0.5);
+}
+
+void requestVirtualPage(float2 uv, uint mip)
+{
+  uint pageCount, pageCountY;
+  g_uavPageFeedback.GetDimensions(pageCount, pageCountY);
+
+  uint2 page = min( uint2( saturate( uv ) * pageCount ), pageCount - 1 );
+  InterlockedMin( g_uavPageFeedback[page], mip );
+}
+
+// Writes the mip required by each visible pixel into the mip 0 page grid of the virtual shadow map.
+// The footprint of a pixel in the shadow map is measured against its closest horizontal and vertical neighbours,
+// so depth discontinuities do not request needlessly coarse pages. The pages under the filter kernel corners are requested too
+void shadowFeedback( PS_FullscreenInput I )
+{
+  int2 pixel = int2( I.position.xy );
+  float4 world_space_position = calculateWorldSpacePositionFromPixel(pixel);
+  float4 world_space_right = calculateWorldSpacePositionFromPixel(pixel + int2(1, 0));
+  float4 world_space_left = calculateWorldSpacePositionFromPixel(pixel - int2(1, 0));
+  float4 world_space_down = calculateWorldSpacePositionFromPixel(pixel + int2(0, 1));
+  float4 world_space_up = calculateWorldSpacePositionFromPixel(pixel - int2(0, 1));
+
+  uint pageCount, pageCountY;
+  g_uavPageFeedback.GetDimensions(pageCount, pageCountY);
+  uint lastMip = firstbithigh(pageCount);
+
+  bool continueShadow = true;
+  uint active = 0;
+
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_UNION || AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CASCADE || AMD_SHADOWFX_EXECUTION == SHADOWFX_EXECUTION_WEIGHTED_AVG)
+  for (active = 0; (active < g_cbShadowsData.m_ActiveLightCount) && continueShadow; active++)
+#endif
+  {
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CUBE)
+    active = transformWorldPositionToCubeFace(world_space_position);
+#endif
+
+    ShadowsLightData lightData = g_cbShadowsData.m_Light[active];
+
+    float4 shadow_space_pos = calculateShadowSpacePosition(world_space_position, lightData);
+    float2 uv = float2(shadow_space_pos.x * 0.5 + 0.5, 0.5 - shadow_space_pos.y * 0.5);
+
+    if (uv.x>=0 && uv.x<=1 &&
+      uv.y>=0 && uv.y<=1 &&
+      shadow_space_pos.z>=0 && shadow_space_pos.z<=1)
+    {
+      float2 dx = min( abs( calculateShadowSpaceUV(world_space_right, lightData) - uv ), abs( calculateShadowSpaceUV(world_space_left, lightData) - uv ) );
+      float2 dy = min( abs( calculateShadowSpaceUV(world_space_down, lightData) - uv ), abs( calculateShadowSpaceUV(world_space_up, lightData) - uv ) );
+      float2 footprint = max( dx, dy ) * lightData.m_Size.xy; // in mip 0 texels
+      uint mip = min( uint( max( log2( max( footprint.x, footprint.y ) ), 0.0f ) ), lastMip );
+
+      float4 shadowRegion;
+      shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+      shadowRegion.zw = lightData.m_Region.xy;
+
+      float2 radius = FR * lightData.m_SizeInv.xy;
+
+      requestVirtualPage( uv * shadowRegion.xy + shadowRegion.zw, mip );
+      requestVirtualPage( ( uv + float2(-radius.x, -radius.y) ) * shadowRegion.xy + shadowRegion.zw, mip );
+      requestVirtualPage( ( uv + float2( radius.x, -radius.y) ) * shadowRegion.xy + shadowRegion.zw, mip );
+      requestVirtualPage( ( uv + float2(-radius.x,  radius.y) ) * shadowRegion.xy + shadowRegion.zw, mip );
+      requestVirtualPage( ( uv + float2( radius.x,  radius.y) ) * shadowRegion.xy + shadowRegion.zw, mip );
+
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CASCADE)
+      continueShadow = false;
+#endif
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------------
+// DEPTH BOUNDS REDUCTION
+//--------------------------------------------------------------------------------------
+
+#define DEPTH_BOUNDS_TILE_SIZE                                   8
+#define DEPTH_BOUNDS_COUNT                                       ( 2 + 6 * AMD_SHADOWFX_ACTIVE_LIGHT_COUNT )
+#define DEPTH_BOUNDS_EMPTY                                       0xffffffff
+
+groupshared uint g_DepthBounds[DEPTH_BOUNDS_COUNT];
+
+// maps a float to a uint with the same ordering so bounds can be reduced with integer atomics
+uint orderedFloat(float value)
+{
+  uint bits = asuint( value );
+  return ( bits & 0x80000000 ) ? ~bits : ( bits | 0x80000000 );
+}
+
+// maxima are stored inverted so that every slot is reduced with InterlockedMin and cleared to DEPTH_BOUNDS_EMPTY
+void reduceDepthBounds(uint index, float value)
+{
+  InterlockedMin( g_DepthBounds[index], orderedFloat( value ) );
+}
+
+void reduceDepthBoundsMax(uint index, float value)
+{
+  InterlockedMin( g_DepthBounds[index], ~orderedFloat( value ) );
+}
+
+// Reduces the view depth range of the visible pixels and, for each light, the bounds of the receivers in its shadow space
+// (uv.x, uv.y and depth). Slot 0 and 1 hold the min and max view depth, then 6 slots per light hold the receiver min.xyz and max.xyz.
+// Background pixels (depth 1) are skipped. Each group reduces in shared memory and issues one global atomic per slot
+[numthreads(DEPTH_BOUNDS_TILE_SIZE, DEPTH_BOUNDS_TILE_SIZE, 1)]
+void shadowDepthBounds( uint3 dispatchThreadID : SV_DispatchThreadID, uint groupIndex : SV_GroupIndex )
+{
+  for (uint i = groupIndex; i < DEPTH_BOUNDS_COUNT; i += DEPTH_BOUNDS_TILE_SIZE * DEPTH_BOUNDS_TILE_SIZE)
+  {
+    g_DepthBounds[i] = DEPTH_BOUNDS_EMPTY;
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  int2 pixel = int2( dispatchThreadID.xy );
+  float depth = g_t2dDepth.Load( int3( pixel, 0 ) ).x;
+
+  if (all( pixel < int2( g_cbShadowsData.m_Size ) ) && depth < 1.0f)
+  {
+    float viewDepth = abs( calculateViewSpaceDepth( depth ) );
+    reduceDepthBounds( 0, viewDepth );
+    reduceDepthBoundsMax( 1, viewDepth );
+
+    float4 world_space_position = calculateWorldSpacePositionFromPixel(pixel);
+
+    bool continueShadow = true;
+    uint active = 0;
+
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_UNION || AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CASCADE || AMD_SHADOWFX_EXECUTION == SHADOWFX_EXECUTION_WEIGHTED_AVG)
+    for (active = 0; (active < g_cbShadowsData.m_ActiveLightCount) && continueShadow; active++)
+#endif
+    {
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CUBE)
+      active = transformWorldPositionToCubeFace(world_space_position);
+#endif
+
+      float4 shadow_space_pos = calculateShadowSpacePosition(world_space_position, g_cbShadowsData.m_Light[active]);
+      float3 receiver = float3(shadow_space_pos.x * 0.5 + 0.5, 0.5 - shadow_space_pos.y * 0.5, shadow_space_pos.z);
+
+      if (receiver.x>=0 && receiver.x<=1 &&
+        receiver.y>=0 && receiver.y<=1 &&
+        receiver.z>=0 && receiver.z<=1)
+      {
+        uint slot = 2 + 6 * active;
+        [unroll]for (uint c = 0; c < 3; c++)
+        {
+          reduceDepthBounds( slot + c, receiver[c] );
+          reduceDepthBoundsMax( slot + 3 + c, receiver[c] );
+        }
+
+#if (AMD_SHADOWFX_EXECUTION == AMD_SHADOWFX_EXECUTION_CASCADE)
+        continueShadow = false;
+#endif
+      }
+    }
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  for (uint j = groupIndex; j < DEPTH_BOUNDS_COUNT; j += DEPTH_BOUNDS_TILE_SIZE * DEPTH_BOUNDS_TILE_SIZE)
+  {
+    if (g_DepthBounds[j] != DEPTH_BOUNDS_EMPTY)
+    {
+      g_uavDepthBounds.InterlockedMin( j * 4, g_DepthBounds[j] );
+    }
+  }
+}
 
 //--------------------------------------------------------------------------------------
 // EOF
@@ -57,6 +57,7 @@
 
 #define AMD_SHADOWFX_TAP_TYPE_FIXED                         0
 #define AMD_SHADOWFX_TAP_TYPE_POISSON                       1
+#define AMD_SHADOWFX_TAP_TYPE_POISSON_ROTATED               2
 #ifndef AMD_SHADOWFX_TAP_TYPE
 # define AMD_SHADOWFX_TAP_TYPE                              AMD_SHADOWFX_TAP_TYPE_FIXED
 #endif
@@ -71,6 +72,7 @@
 
 #define AMD_SHADOWFX_TEXTURE_2D                             0
 #define AMD_SHADOWFX_TEXTURE_2D_ARRAY                       1
+#define AMD_SHADOWFX_TEXTURE_2D_VIRTUAL                     2
 #ifndef AMD_SHADOWFX_TEXTURE_TYPE
 # define AMD_SHADOWFX_TEXTURE_TYPE                          AMD_SHADOWFX_TEXTURE_2D
 #endif
@@ -83,6 +85,26 @@
 # define AMD_SHADOWFX_ACTIVE_LIGHT_COUNT                    6      
 #endif
 
+// Poisson tap count. 0 selects the default table of each filter size
+// 8, 12 and 16 select the reduced tables generated by amd_shadowfx/tools/poisson_gen
+// Rotated poisson relies on the per pixel rotation and the denoise pass to hide the lower count
+#ifndef AMD_SHADOWFX_POISSON_TAP_COUNT
+# if (AMD_SHADOWFX_TAP_TYPE == AMD_SHADOWFX_TAP_TYPE_POISSON_ROTATED)
+#  define AMD_SHADOWFX_POISSON_TAP_COUNT                    12
+# else
+#  define AMD_SHADOWFX_POISSON_TAP_COUNT                    0
+# endif
+#endif
+
+// Denoise kernel radius (5x5) and the relative view depth difference at which a neighbour stops contributing
+#define AMD_SHADOWFX_DENOISE_RADIUS                         2
+#define AMD_SHADOWFX_DENOISE_DEPTH_SIGMA                    0.02f
+
+// virtual shadow map page layout, must match gu::virtual_shadow_map_desc
+#define AMD_SHADOWFX_VIRTUAL_PAGE_SIZE                      128
+#define AMD_SHADOWFX_VIRTUAL_PAGE_BORDER                    1
+#define AMD_SHADOWFX_VIRTUAL_SLOT_SIZE                      ( AMD_SHADOWFX_VIRTUAL_PAGE_SIZE + 2 * AMD_SHADOWFX_VIRTUAL_PAGE_BORDER )
+
 #define DEPTH_BIAS                                         0.0000f
 #define DEPTH_SCALE                                        1.0000f
 
@@ -91,19 +113,59 @@
 //--------------------------------------------------------------------------------------
 #if   (AMD_SHADOWFX_FILTER_SIZE == AMD_SHADOWFX_FILTER_SIZE_7)
 #include "AMD_SHADOWFX_FILTER_SIZE_7_FIXED.inc"
-#include "AMD_SHADOWFX_FILTER_SIZE_7_POISSON.inc"
+# if   (AMD_SHADOWFX_POISSON_TAP_COUNT == 8)
+#  include "AMD_SHADOWFX_FILTER_SIZE_7_POISSON_8.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 12)
+#  include "AMD_SHADOWFX_FILTER_SIZE_7_POISSON_12.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 16)
+#  include "AMD_SHADOWFX_FILTER_SIZE_7_POISSON_16.inc"
+# else
+#  include "AMD_SHADOWFX_FILTER_SIZE_7_POISSON.inc"
+# endif
 #elif (AMD_SHADOWFX_FILTER_SIZE == AMD_SHADOWFX_FILTER_SIZE_9)
 #include "AMD_SHADOWFX_FILTER_SIZE_9_FIXED.inc"
-#include "AMD_SHADOWFX_FILTER_SIZE_9_POISSON.inc"
+# if   (AMD_SHADOWFX_POISSON_TAP_COUNT == 8)
+#  include "AMD_SHADOWFX_FILTER_SIZE_9_POISSON_8.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 12)
+#  include "AMD_SHADOWFX_FILTER_SIZE_9_POISSON_12.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 16)
+#  include "AMD_SHADOWFX_FILTER_SIZE_9_POISSON_16.inc"
+# else
+#  include "AMD_SHADOWFX_FILTER_SIZE_9_POISSON.inc"
+# endif
 #elif (AMD_SHADOWFX_FILTER_SIZE == AMD_SHADOWFX_FILTER_SIZE_11)
 #include "AMD_SHADOWFX_FILTER_SIZE_11_FIXED.inc"
-#include "AMD_SHADOWFX_FILTER_SIZE_11_POISSON.inc"
+# if   (AMD_SHADOWFX_POISSON_TAP_COUNT == 8)
+#  include "AMD_SHADOWFX_FILTER_SIZE_11_POISSON_8.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 12)
+#  include "AMD_SHADOWFX_FILTER_SIZE_11_POISSON_12.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 16)
+#  include "AMD_SHADOWFX_FILTER_SIZE_11_POISSON_16.inc"
+# else
+#  include "AMD_SHADOWFX_FILTER_SIZE_11_POISSON.inc"
+# endif
 #elif (AMD_SHADOWFX_FILTER_SIZE == AMD_SHADOWFX_FILTER_SIZE_13)
 #include "AMD_SHADOWFX_FILTER_SIZE_13_FIXED.inc"
-#include "AMD_SHADOWFX_FILTER_SIZE_13_POISSON.inc"
+# if   (AMD_SHADOWFX_POISSON_TAP_COUNT == 8)
+#  include "AMD_SHADOWFX_FILTER_SIZE_13_POISSON_8.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 12)
+#  include "AMD_SHADOWFX_FILTER_SIZE_13_POISSON_12.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 16)
+#  include "AMD_SHADOWFX_FILTER_SIZE_13_POISSON_16.inc"
+# else
+#  include "AMD_SHADOWFX_FILTER_SIZE_13_POISSON.inc"
+# endif
 #elif (AMD_SHADOWFX_FILTER_SIZE == AMD_SHADOWFX_FILTER_SIZE_15)
 #include "AMD_SHADOWFX_FILTER_SIZE_15_FIXED.inc"
-#include "AMD_SHADOWFX_FILTER_SIZE_15_POISSON.inc"
+# if   (AMD_SHADOWFX_POISSON_TAP_COUNT == 8)
+#  include "AMD_SHADOWFX_FILTER_SIZE_15_POISSON_8.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 12)
+#  include "AMD_SHADOWFX_FILTER_SIZE_15_POISSON_12.inc"
+# elif (AMD_SHADOWFX_POISSON_TAP_COUNT == 16)
+#  include "AMD_SHADOWFX_FILTER_SIZE_15_POISSON_16.inc"
+# else
+#  include "AMD_SHADOWFX_FILTER_SIZE_15_POISSON.inc"
+# endif
 #endif
 
 struct Camera
@@ -132,7 +194,7 @@ struct ShadowsLightData
   float2                                                   m_SizeInv;
   float4                                                   m_Region;
 
-  float4                                                   m_Weight;
+  float4                                                   m_Weight; // .x weight of SHADOWFX_EXECUTION_WEIGHTED_AVG, .y non zero for a wrapped array slice
 
   float                                                    m_SunArea;
   float                                                    m_DepthTestOffset;
@@ -158,13 +220,28 @@ Texture2D<float4>                                          g_t2dNormal
 Texture2D<float>                                           g_t2dShadow             : register( t2 );
 #elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
 Texture2DArray<float>                                      g_t2dShadow             : register( t2 );
+#elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+Texture2D<float>                                           g_t2dShadow             : register( t2 ); // physical page atlas
 #endif
 
+Texture2D<float>                                           g_t2dShadowMask         : register( t3 ); // only used by the denoise pass
+Texture2D<uint>                                            g_t2dPageTable          : register( t4 ); // only used by virtual shadow maps
+RWTexture2D<uint>                                          g_uavPageFeedback       : register( u0 ); // only used by the feedback pass
+RWByteAddressBuffer                                        g_uavDepthBounds        : register( u1 ); // only used by the depth bounds reduction
+
 SamplerState                                               g_ssPoint               : register( s0 );
 SamplerState                                               g_ssLinear              : register( s1 );
 SamplerComparisonState                                     g_scsPoint              : register( s2 );
 SamplerComparisonState                                     g_scsLinear             : register( s3 );
 
+#if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
+// wrap addressing counterparts of s0-s3, used for the slices of wrapped lights
+SamplerState                                               g_ssPointWrap           : register( s4 );
+SamplerState                                               g_ssLinearWrap          : register( s5 );
+SamplerComparisonState                                     g_scsPointWrap          : register( s6 );
+SamplerComparisonState                                     g_scsLinearWrap         : register( s7 );
+#endif
+
 cbuffer CB_SHADOWS_DATA                                                            : register( b0 )
 { 
   ShadowsData                                              g_cbShadowsData;
@@ -178,42 +255,109 @@ struct PS_ShadowMaskOutput
 //--------------------------------------------------------------------------------------
 // Utility functions 
 //--------------------------------------------------------------------------------------
-float shadowSample(SamplerState samplerState, float2 uv, uint slice)
+#if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+// translate a virtual shadow map uv into the physical page atlas.
+// Each page table entry points to the finest rendered page covering it (see gu::pack_page_table_entry)
+float2 virtualShadowTranslate(float2 uv)
+{
+  uint pageCount, pageCountY;
+  g_t2dPageTable.GetDimensions(pageCount, pageCountY);
+  float physicalWidth, physicalHeight;
+  g_t2dShadow.GetDimensions(physicalWidth, physicalHeight);
+
+  float2 virtualPage = saturate(uv) * pageCount;
+  uint entry = g_t2dPageTable.Load( int3( min( uint2( virtualPage ), pageCount - 1 ), 0 ) );
+
+  uint2 slot = uint2( entry & 0xfff, ( entry >> 12 ) & 0xfff );
+  uint mip = ( entry >> 24 ) & 0xf;
+
+  float2 local = frac( virtualPage / float( 1u << mip ) );
+  float2 texel = slot * AMD_SHADOWFX_VIRTUAL_SLOT_SIZE + AMD_SHADOWFX_VIRTUAL_PAGE_BORDER + local * AMD_SHADOWFX_VIRTUAL_PAGE_SIZE;
+
+  return texel / float2( physicalWidth, physicalHeight );
+}
+#endif
+
+#if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
+// Clipmap cascades are addressed toroidally: the slice keeps the texels that are still valid when the cascade
+// scrolls and m_Region is offset by the scroll (see gu::shadow_clipmap). Their kernels are fetched with the
+// wrap samplers so they filter across the seam. The helpers below are each called with a single sampler,
+// the branch selects its wrap counterpart
+bool shadowWrap(ShadowsLightData lightData)
+{
+  return lightData.m_Weight.y != 0;
+}
+#endif
+
+float shadowSample(SamplerState samplerState, float2 uv, ShadowsLightData lightData)
 {
 #if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D)
   return g_t2dShadow.SampleLevel(samplerState, uv, 0);
 #elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
-  return g_t2dShadow.SampleLevel(samplerState, float3(uv, slice), 0);
+  [branch] if ( shadowWrap( lightData ) )
+    return g_t2dShadow.SampleLevel(g_ssPointWrap, float3(uv, lightData.m_ArraySlice), 0);
+  return g_t2dShadow.SampleLevel(samplerState, float3(uv, lightData.m_ArraySlice), 0);
+#elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+  return g_t2dShadow.SampleLevel(samplerState, virtualShadowTranslate(uv), 0);
 #endif
 }
 
-float shadowSampleCmp(SamplerComparisonState samplerCmpState, float2 uv, float z, uint slice)
+float shadowSampleCmp(SamplerComparisonState samplerCmpState, float2 uv, float z, ShadowsLightData lightData)
 {
 #if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D)
   return g_t2dShadow.SampleCmpLevelZero(samplerCmpState, uv, z);
 #elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
-  return g_t2dShadow.SampleCmpLevelZero(samplerCmpState, float3(uv, slice), z);
+  [branch] if ( shadowWrap( lightData ) )
+    return g_t2dShadow.SampleCmpLevelZero(g_scsLinearWrap, float3(uv, lightData.m_ArraySlice), z);
+  return g_t2dShadow.SampleCmpLevelZero(samplerCmpState, float3(uv, lightData.m_ArraySlice), z);
+#elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+  return g_t2dShadow.SampleCmpLevelZero(samplerCmpState, virtualShadowTranslate(uv), z);
 #endif
 }
 
-float4 shadowGather(SamplerState samplerState, float2 uv, uint slice)
+float4 shadowGather(SamplerState samplerState, float2 uv, ShadowsLightData lightData)
 {
 #if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D)
   return g_t2dShadow.GatherRed(samplerState, uv);
 #elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
-  return g_t2dShadow.GatherRed(samplerState, float3(uv, slice));
+  [branch] if ( shadowWrap( lightData ) )
+    return g_t2dShadow.GatherRed(g_ssPointWrap, float3(uv, lightData.m_ArraySlice));
+  return g_t2dShadow.GatherRed(samplerState, float3(uv, lightData.m_ArraySlice));
+#elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+  return g_t2dShadow.GatherRed(samplerState, virtualShadowTranslate(uv));
 #endif
 }
 
-float4 shadowGatherCmp(SamplerComparisonState samplerCmpState, float2 uv, float z, uint slice)
+float4 shadowGatherCmp(SamplerComparisonState samplerCmpState, float2 uv, float z, ShadowsLightData lightData)
 {
 #if (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D)
   return g_t2dShadow.GatherCmpRed(samplerCmpState, uv, z);
 #elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_ARRAY)
-  return g_t2dShadow.GatherCmpRed(samplerCmpState, float3(uv, slice), z);
+  [branch] if ( shadowWrap( lightData ) )
+    return g_t2dShadow.GatherCmpRed(g_scsPointWrap, float3(uv, lightData.m_ArraySlice), z);
+  return g_t2dShadow.GatherCmpRed(samplerCmpState, float3(uv, lightData.m_ArraySlice), z);
+#elif (AMD_SHADOWFX_TEXTURE_TYPE == AMD_SHADOWFX_TEXTURE_2D_VIRTUAL)
+  return g_t2dShadow.GatherCmpRed(samplerCmpState, virtualShadowTranslate(uv), z);
 #endif
 }
 
+// Interleaved gradient noise as described in
+// http://www.iryoku.com/next-generation-post-processing-in-call-of-duty-advanced-warfare
+// slide 123. Neighbouring pixels get well distributed values which a small spatial filter averages out
+float interleavedGradientNoise(float2 pixel)
+{
+  return frac( 52.9829189f * frac( dot( pixel, float2( 0.06711056f, 0.00583715f ) ) ) );
+}
+
+// rotation applied to the poisson set of a given screen pixel
+float2x2 poissonRotation(float2 pixel)
+{
+  float angle = interleavedGradientNoise(floor(pixel)) * 6.28318530718f;
+  float s, c;
+  sincos(angle, s, c);
+  return float2x2(c, s, -s, c);
+}
+
 float4 transformPositionWithProjection(float4 position, float4x4 m)
 {
   float4 m_position = mul(position, m);
@@ -294,13 +438,8 @@ float3 calculateWorldSpaceNormal(float2 uv)
 float uniformFixedGather4( float3 shadowSpaceCoord, ShadowsLightData lightData )
 {
   float4 shadowRegion;
-#if (AMD_SHADOWFX_TEXTURE_TYPE == 1)
-  shadowRegion.xy = float2(1, 1);
-  shadowRegion.zw = float2(0, 0);
-#else
   shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
   shadowRegion.zw = lightData.m_Region.xy;
-#endif
 
   // calculate integer and fractional parts of shadow space texture coordinate
   // discard the fractional part of shadow space texture coordinate
@@ -316,7 +455,7 @@ float uniformFixedGather4( float3 shadowSpaceCoord, ShadowsLightData lightData )
   {
     [unroll]for( int col = -AMD_SHADOWS_FILTER_RADIUS; col <= AMD_SHADOWS_FILTER_RADIUS; col += 2 )
     {
-      float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+      float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
 
       float4 filter_weight = float4(1,1,1,1);
       // this is Edge Tap Smoothing as described in
@@ -355,13 +494,8 @@ float uniformFixedGather4( float3 shadowSpaceCoord, ShadowsLightData lightData )
 float uniformFixedPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
 {
   float4 shadowRegion;
-#if (AMD_SHADOWFX_TEXTURE_TYPE == 1)
-  shadowRegion.xy = float2(1, 1);
-  shadowRegion.zw = float2(0, 0);
-#else
   shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
   shadowRegion.zw = lightData.m_Region.xy;
-#endif
 
   float3 shadowUVZ = float3(shadowSpaceCoord.xy * shadowRegion.xy + shadowRegion.zw, shadowSpaceCoord.z - lightData.m_DepthTestOffset);
 
@@ -371,7 +505,7 @@ float uniformFixedPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
   {
     [unroll]for( float col = -AMD_SHADOWS_FILTER_RADIUS; col <= AMD_SHADOWS_FILTER_RADIUS; col += 1 )
     {
-      float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+      float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
       accumulatedShadow += shadow;
     }
   }
@@ -401,7 +535,7 @@ float uniformPoissonGather4( float3 shadowSpaceCoord, ShadowsLightData lightData
     // discard the fractional part of shadow space texture coordinate
     shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
 
-    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy, shadowUVZ.z, lightData.m_ArraySlice );
+    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy, shadowUVZ.z, lightData );
 
     float4 filter_weight = float4(1,1,1,1);
     // this is Edge Tap Smoothing as described in
@@ -451,7 +585,7 @@ float uniformPoissonPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
   for( uint i = 0; i < g_PoissonSamplesCount; i += 1 )
   {
     float weight = exp( -((g_PoissonSamples[i].x*g_PoissonSamples[i].x) + (g_PoissonSamples[i].y*g_PoissonSamples[i].y)) / (FR*FR) );
-    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
 
     accumulatedShadow += shadow * weight;
     accumulatedWeight += weight;
@@ -460,6 +594,72 @@ float uniformPoissonPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
   return accumulatedShadow * ( 1.0f / accumulatedWeight ) ;
 }
 
+float uniformRotatedPoissonGather4( float3 shadowSpaceCoord, float2 pixel, ShadowsLightData lightData )
+{
+  float4 shadowRegion;
+  shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+  shadowRegion.zw = lightData.m_Region.xy;
+
+  float2x2 rotation = poissonRotation(pixel);
+
+  float accumulatedShadow = 0.0f;
+  float accumulatedWeight = 0.0f;
+
+  [unroll]
+  for( uint i = 0; i < g_PoissonSamplesCount; i += 1 )
+  {
+    // rotation preserves the distance to the center so the weight is the same as for the unrotated tap
+    float2 offset = mul( g_PoissonSamples[i].xy, rotation );
+    float weight = exp( -dot(offset, offset) / (FR*FR) );
+
+    // rotated taps do not land on texel centers: gather the 4 surrounding texels and weight them bilinearly
+    float3 shadowUVZ = float3(shadowSpaceCoord.xy, shadowSpaceCoord.z - lightData.m_DepthTestOffset);
+    float2 shadowTextureCoord      = (( lightData.m_Size.xy * shadowSpaceCoord.xy ) + float2( 0.5, 0.5 ) + offset);
+    float2 shadowTextureCoordFloor = floor( shadowTextureCoord );
+    float2 shadowTextureCoordFrac  = frac( shadowTextureCoord );
+    shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
+
+    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy, shadowUVZ.z, lightData );
+
+    float4 filter_weight;
+    filter_weight.x = (1.0 - shadowTextureCoordFrac.x) * shadowTextureCoordFrac.y;
+    filter_weight.y = shadowTextureCoordFrac.x * shadowTextureCoordFrac.y;
+    filter_weight.z = shadowTextureCoordFrac.x * (1.0 - shadowTextureCoordFrac.y);
+    filter_weight.w = (1.0 - shadowTextureCoordFrac.x) * (1.0 - shadowTextureCoordFrac.y);
+
+    accumulatedShadow += dot(filter_weight, shadow) * weight;
+    accumulatedWeight += weight;
+  }
+
+  return accumulatedShadow * ( 1.0f / accumulatedWeight );
+}
+
+float uniformRotatedPoissonPCF( float3 shadowSpaceCoord, float2 pixel, ShadowsLightData lightData )
+{
+  float accumulatedShadow = 0.0f;
+  float accumulatedWeight = 0.0f;
+
+  float4 shadowRegion;
+  shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+  shadowRegion.zw = lightData.m_Region.xy;
+  float3 shadowUVZ = float3(shadowSpaceCoord.xy * shadowRegion.xy + shadowRegion.zw, shadowSpaceCoord.z - lightData.m_DepthTestOffset);
+
+  float2x2 rotation = poissonRotation(pixel);
+
+  [unroll]
+  for( uint i = 0; i < g_PoissonSamplesCount; i += 1 )
+  {
+    float2 offset = mul( g_PoissonSamples[i].xy, rotation );
+    float weight = exp( -dot(offset, offset) / (FR*FR) );
+    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + offset * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
+
+    accumulatedShadow += shadow * weight;
+    accumulatedWeight += weight;
+  }
+
+  return accumulatedShadow * ( 1.0f / accumulatedWeight );
+}
+
 //--------------------------------------------------------------------------------------
 // CONTACT shadow filtering
 //--------------------------------------------------------------------------------------
@@ -530,7 +730,7 @@ float2 uniformBlockerSearch( float3 shadowSpaceCoord, ShadowsLightData lightData
   {
     [loop]for(int col = -BFR; col <= BFR; col += 2 )
     {
-      float4 depth = shadowGather( g_ssPoint, shadowSpaceCoord.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, lightData.m_ArraySlice);
+      float4 depth = shadowGather( g_ssPoint, shadowSpaceCoord.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, lightData );
       float4 blocker = ( (shadowSpaceCoord.z).xxxx <= depth ) ? (0.0).xxxx : (1.0).xxxx;
       blockerInfo.x += dot( blocker, (1.0).xxxx );
       blockerInfo.y += dot( depth, blocker );
@@ -555,7 +755,7 @@ float2 poissonBlockerSearch( float3 shadowSpaceCoord, ShadowsLightData lightData
 
   [unroll]for (uint i = 0; i < g_PoissonSamplesCount; i++) 
   {
-    float4 depth = shadowGather( g_ssPoint, shadowSpaceCoord.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, lightData.m_ArraySlice);
+    float4 depth = shadowGather( g_ssPoint, shadowSpaceCoord.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, lightData );
     float4 blocker = ( (shadowSpaceCoord.z).xxxx <= depth ) ? (0.0).xxxx : (1.0).xxxx;
     blockerInfo.x += dot( blocker, (1.0).xxxx );
     blockerInfo.y += dot( depth, blocker );
@@ -623,7 +823,7 @@ float contactFixedGather4( float3 shadowSpaceCoord, ShadowsLightData lightData )
 
       // on each row iteration, depth values are fetched and stored inside currDepthRow array
       // because of gather 4 we are actually sampling 2x2 depth values, so 2 rows and 2 columns at a time
-      currDepthRow[dIdx] = shadowGatherCmp( g_scsPoint, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+      currDepthRow[dIdx] = shadowGatherCmp( g_scsPoint, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
 
       uint lCol = cIdx - 1;
       uint rCol = cIdx + 1;
@@ -687,7 +887,7 @@ float contactFixedPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
     [unroll]for( float col = -FR; col <= FR; col += 1 )
     {
       float weight = fetchFilterWeight(row+FR, col+FR, ratio);
-      float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+      float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + float2(col, row) * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
 
       accumulatedShadow += shadow * weight;
       accumulatedWeight += weight;
@@ -744,7 +944,7 @@ float contactPoissonGather4( float3 shadowSpaceCoord, ShadowsLightData lightData
     shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
 
     // the sampling code below is actually INCORRECT because it uses g_PoissonSamples offsets twice (first when shadowUVZ is calculated and second time during the fetch
-    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy /*+ g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy*/, shadowUVZ.z, lightData.m_ArraySlice );
+    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy /*+ g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy*/, shadowUVZ.z, lightData );
 
     float4 filter_weight = float4(1,1,1,1);
     // this is Edge Tap Smoothing as described in
@@ -819,7 +1019,141 @@ float contactPoissonPCF( float3 shadowSpaceCoord, ShadowsLightData lightData )
   for( uint i = 0; i < g_PoissonSamplesCount; i += 1 )
   {
     float weight = calculateFilterWeight(g_PoissonSamples[i].x, g_PoissonSamples[i].y, ratio);
-    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData.m_ArraySlice );
+    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + g_PoissonSamples[i].xy * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
+
+    accumulatedShadow += shadow * weight;
+    accumulatedWeight += weight;
+  }
+
+  accumulatedShadow = accumulatedShadow / accumulatedWeight;
+
+  return accumulatedShadow; 
+}
+
+float2 rotatedPoissonBlockerSearch( float3 shadowSpaceCoord, float2x2 rotation, ShadowsLightData lightData )
+{
+  float4 shadowRegion;
+  shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+  shadowRegion.zw = lightData.m_Region.xy;
+
+  float2 blockerInfo = { 0.0f, 0.0f };
+
+  [unroll]for (uint i = 0; i < g_PoissonSamplesCount; i++) 
+  {
+    float2 offset = mul( g_PoissonSamples[i].xy, rotation );
+    float4 depth = shadowGather( g_ssPoint, shadowSpaceCoord.xy + offset * lightData.m_SizeInv.xy * shadowRegion.xy, lightData );
+    float4 blocker = ( (shadowSpaceCoord.z).xxxx <= depth ) ? (0.0).xxxx : (1.0).xxxx;
+    blockerInfo.x += dot( blocker, (1.0).xxxx );
+    blockerInfo.y += dot( depth, blocker );
+  }
+
+  if (blockerInfo.x > 0.0)
+    blockerInfo.y /= blockerInfo.x;
+
+  blockerInfo.x /= (g_PoissonSamplesCount * 4.0f); // each rotated sample fetches 4 samples through gather4
+
+  return blockerInfo;
+}
+
+float contactRotatedPoissonGather4( float3 shadowSpaceCoord, float2 pixel, ShadowsLightData lightData )
+{
+  float4 shadowRegion;
+  shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+  shadowRegion.zw = lightData.m_Region.xy;
+
+  float2x2 rotation = poissonRotation(pixel);
+
+  float3 shadowUVZ = float3(shadowSpaceCoord.xy, shadowSpaceCoord.z - lightData.m_DepthTestOffset);
+  float2 shadowTextureCoord = (( lightData.m_Size.xy * shadowUVZ.xy ) + float2( 0.5, 0.5 ));
+  float2 shadowTextureCoordFrac = frac(shadowTextureCoord);
+  float2 shadowTextureCoordFloor = floor(shadowTextureCoord);
+  shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
+
+  float2 blockerInfo = rotatedPoissonBlockerSearch(shadowUVZ, rotation, lightData);
+  float blockerCount = blockerInfo.x;
+  float blockerDepth = blockerInfo.y;
+
+  // compute ratio using formulas from PCSS
+  float ratio = 0.0f;
+  if( blockerCount > 0.0 && blockerCount < 1.0f ) 
+  {
+    ratio = percentageCloserSoftShadows( shadowSpaceCoord.z, blockerDepth, lightData.m_SunArea); 
+  }
+  else // Early out - fully lit or fully in shadow depends on blockerCount
+  {
+    return 1.0f - blockerCount; 
+  }
+
+  float accumulatedShadow = 0.0f;
+  float accumulatedWeight = 0.0f;
+
+  [unroll]for (uint i = 0; i < g_PoissonSamplesCount; i++) 
+  {
+    float2 offset = mul( g_PoissonSamples[i].xy, rotation );
+    float weight = calculateFilterWeight(offset.x, offset.y, ratio);
+
+    // rotated taps do not land on texel centers: gather the 4 surrounding texels and weight them bilinearly
+    shadowTextureCoord      = (( lightData.m_Size.xy * shadowSpaceCoord.xy ) + float2( 0.5, 0.5 ) + offset);
+    shadowTextureCoordFrac  = frac( shadowTextureCoord );
+    shadowTextureCoordFloor = floor( shadowTextureCoord );
+    shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
+
+    float4 shadow = shadowGatherCmp( g_scsPoint, shadowUVZ.xy, shadowUVZ.z, lightData );
+
+    float4 filter_weight;
+    filter_weight.x = (1.0 - shadowTextureCoordFrac.x) * shadowTextureCoordFrac.y;
+    filter_weight.y = shadowTextureCoordFrac.x * shadowTextureCoordFrac.y;
+    filter_weight.z = shadowTextureCoordFrac.x * (1.0 - shadowTextureCoordFrac.y);
+    filter_weight.w = (1.0 - shadowTextureCoordFrac.x) * (1.0 - shadowTextureCoordFrac.y);
+
+    accumulatedShadow += dot(filter_weight, shadow) * weight;
+    accumulatedWeight += weight;
+  }
+
+  accumulatedShadow = accumulatedShadow / accumulatedWeight;
+
+  return accumulatedShadow; 
+}
+
+float contactRotatedPoissonPCF( float3 shadowSpaceCoord, float2 pixel, ShadowsLightData lightData )
+{
+  float4 shadowRegion;
+  shadowRegion.xy = lightData.m_Region.zw - lightData.m_Region.xy;
+  shadowRegion.zw = lightData.m_Region.xy;
+
+  float2x2 rotation = poissonRotation(pixel);
+
+  float3 shadowUVZ = float3(shadowSpaceCoord.xy, shadowSpaceCoord.z - lightData.m_DepthTestOffset);
+  float2 shadowTextureCoord = (( lightData.m_Size.xy * shadowUVZ.xy ) + float2( 0.5, 0.5 ));
+  float2 shadowTextureCoordFloor = floor( shadowTextureCoord );
+  shadowUVZ.xy = shadowTextureCoordFloor * lightData.m_SizeInv.xy * shadowRegion.xy + shadowRegion.zw;
+
+  float2 blockerInfo = rotatedPoissonBlockerSearch(shadowUVZ, rotation, lightData);
+  float blockerCount = blockerInfo.x;
+  float blockerDepth = blockerInfo.y;
+
+  // compute ratio using formulas from PCSS
+  float ratio = 0.0f;
+  if( blockerCount > 0.0 && blockerCount < 1.0f) 
+  {
+    ratio = percentageCloserSoftShadows( shadowSpaceCoord.z, blockerDepth, lightData.m_SunArea); 
+  }
+  else // Early out - fully lit or fully in shadow depends on blockerCount
+  {
+    return 1.0f - blockerCount; 
+  }
+
+  float accumulatedShadow = 0.0f;
+  float accumulatedWeight = 0.0f;
+
+  shadowUVZ.xy = shadowSpaceCoord.xy * shadowRegion.xy + shadowRegion.zw;
+
+  [unroll]
+  for( uint i = 0; i < g_PoissonSamplesCount; i += 1 )
+  {
+    float2 offset = mul( g_PoissonSamples[i].xy, rotation );
+    float weight = calculateFilterWeight(offset.x, offset.y, ratio);
+    float shadow = shadowSampleCmp( g_scsLinear, shadowUVZ.xy + offset * lightData.m_SizeInv.xy * shadowRegion.xy, shadowUVZ.z, lightData );
 
     accumulatedShadow += shadow * weight;
     accumulatedWeight += weight;
@@ -843,7 +1177,7 @@ float pointFilter( float3 shadowSpaceCoord, ShadowsLightData lightData )
   shadowSpaceCoord.xy = shadowSpaceCoord.xy * shadowRegion.xy + shadowRegion.zw;
   shadowSpaceCoord.xy = clamp(shadowSpaceCoord.xy, lightData.m_Region.xy, lightData.m_Region.zw);
   
-  return ( shadowSpaceCoord.z-lightData.m_DepthTestOffset <= shadowSample( g_ssPoint, shadowSpaceCoord.xy, lightData.m_ArraySlice ) ) ? ( 1.0f ) : ( 0.0f );
+  return ( shadowSpaceCoord.z-lightData.m_DepthTestOffset <= shadowSample( g_ssPoint, shadowSpaceCoord.xy, lightData ) ) ? ( 1.0f ) : ( 0.0f );
 }
 
 
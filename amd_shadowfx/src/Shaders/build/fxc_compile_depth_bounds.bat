@@ -0,0 +1,7 @@
+REM Depth bounds reduction compute shaders, one per execution mode
+REM The generated headers are included by AMD_ShadowFX_Precompiled.h, fxc_compile_missing.bat runs this script when they are missing
+
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T cs_5_0 /O1 /E shadowDepthBounds /DAMD_SHADOWFX_EXECUTION=0 /Fh ..\inc\CS_SF_DEPTH_BOUNDS.inc /Vn CS_SF_DEPTH_BOUNDS_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T cs_5_0 /O1 /E shadowDepthBounds /DAMD_SHADOWFX_EXECUTION=1 /Fh ..\inc\CS_SF_CASCADE_DEPTH_BOUNDS.inc /Vn CS_SF_CASCADE_DEPTH_BOUNDS_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T cs_5_0 /O1 /E shadowDepthBounds /DAMD_SHADOWFX_EXECUTION=2 /Fh ..\inc\CS_SF_CUBE_DEPTH_BOUNDS.inc /Vn CS_SF_CUBE_DEPTH_BOUNDS_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T cs_5_0 /O1 /E shadowDepthBounds /DAMD_SHADOWFX_EXECUTION=3 /Fh ..\inc\CS_SF_AVG_DEPTH_BOUNDS.inc /Vn CS_SF_AVG_DEPTH_BOUNDS_Data
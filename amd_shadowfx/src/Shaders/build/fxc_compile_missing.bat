@@ -0,0 +1,13 @@
+@ECHO OFF
+REM Generates the precompiled shader headers that AMD_ShadowFX_Precompiled.h includes and that are not in ..\inc yet
+REM Called by the pre-build step of the AMD_ShadowFX11 and AMD_ShadowFX12 projects, fxc.exe has to be on the PATH
+REM Each script is only run when the last header it writes is missing, delete that header to regenerate its set after changing the HLSL
+
+PUSHD "%~dp0"
+
+IF NOT EXIST ..\inc\PS_SF_T2DA_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV.inc CALL fxc_compile_all_filtering.bat > NUL
+IF NOT EXIST ..\inc\PS_SF_T2DA_AVG_CONTACT_TEX_FETCH_PCF_TAP_TYPE_POISSON_ROTATED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc CALL fxc_compile_rotated_poisson_filtering.bat > NUL
+IF NOT EXIST ..\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV.inc CALL fxc_compile_virtual_filtering.bat > NUL
+IF NOT EXIST ..\inc\CS_SF_AVG_DEPTH_BOUNDS.inc CALL fxc_compile_depth_bounds.bat > NUL
+
+POPD
@@ -0,0 +1,590 @@
+REM Virtual shadow map permutations (AMD_SHADOWFX_TEXTURE_TYPE=2) and the page feedback pass
+REM The generated headers are included by AMD_ShadowFX_Precompiled.h, fxc_compile_missing.bat runs this script when they are missing
+
+REM COMPILE PAGE FEEDBACK
+
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFeedback /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=0 /Fh ..\inc\PS_SF_FEEDBACK.inc /Vn PS_SF_FEEDBACK_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFeedback /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=1 /Fh ..\inc\PS_SF_CASCADE_FEEDBACK.inc /Vn PS_SF_CASCADE_FEEDBACK_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFeedback /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=2 /Fh ..\inc\PS_SF_CUBE_FEEDBACK.inc /Vn PS_SF_CUBE_FEEDBACK_Data
+fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFeedback /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=3 /Fh ..\inc\PS_SF_AVG_FEEDBACK.inc /Vn PS_SF_AVG_FEEDBACK_Data
+
+REM COMPILE TEXTURE_2D_VIRTUAL PERMUTATIONS
+
+REM       COMPILE UNION EXECUTION     
+
+SET FXC_COMPILE_UNIFORM_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=0  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=0
+SET FXC_COMPILE_CONTACT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=1  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=0
+SET FXC_COMPILE_POINT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=10 /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=0
+
+SET ABRV=PS_SF_T2DV_UNIFORM_TEX_FETCH
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+SET ABRV=PS_SF_T2DV_CONTACT_TEX_FETCH
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_NONE.inc /Vn PS_SF_T2DV_POINT_NORMAL_OPTION_NONE_Data /DAMD_SHADOWFX_NORMAL_OPTION=0
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc /Vn PS_SF_T2DV_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data /DAMD_SHADOWFX_NORMAL_OPTION=1
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_POINT_NORMAL_OPTION_READ_FROM_SRV.inc /Vn PS_SF_T2DV_POINT_NORMAL_OPTION_READ_FROM_SRV_Data /DAMD_SHADOWFX_NORMAL_OPTION=2
+
+
+REM       COMPILE CASCADE EXECUTION     
+
+SET FXC_COMPILE_UNIFORM_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=0  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=1
+SET FXC_COMPILE_CONTACT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=1  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=1
+SET FXC_COMPILE_POINT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=10 /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=1
+
+SET ABRV=PS_SF_T2DV_CASCADE_UNIFORM_TEX_FETCH
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+SET ABRV=PS_SF_T2DV_CASCADE_CONTACT_TEX_FETCH
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_NONE.inc /Vn PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_NONE_Data /DAMD_SHADOWFX_NORMAL_OPTION=0
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc /Vn PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data /DAMD_SHADOWFX_NORMAL_OPTION=1
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_READ_FROM_SRV.inc /Vn PS_SF_T2DV_CASCADE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data /DAMD_SHADOWFX_NORMAL_OPTION=2
+
+
+REM       COMPILE CUBE EXECUTION     
+
+SET FXC_COMPILE_UNIFORM_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=0  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=2
+SET FXC_COMPILE_CONTACT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=1  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=2
+SET FXC_COMPILE_POINT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=10 /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=2
+
+SET ABRV=PS_SF_T2DV_CUBE_UNIFORM_TEX_FETCH
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+SET ABRV=PS_SF_T2DV_CUBE_CONTACT_TEX_FETCH
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_NONE.inc /Vn PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_NONE_Data /DAMD_SHADOWFX_NORMAL_OPTION=0
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc /Vn PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data /DAMD_SHADOWFX_NORMAL_OPTION=1
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_READ_FROM_SRV.inc /Vn PS_SF_T2DV_CUBE_POINT_NORMAL_OPTION_READ_FROM_SRV_Data /DAMD_SHADOWFX_NORMAL_OPTION=2
+
+
+REM       COMPILE WEIGHTED AVG EXECUTION     
+
+SET FXC_COMPILE_UNIFORM_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=0  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=3
+SET FXC_COMPILE_CONTACT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=1  /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=3
+SET FXC_COMPILE_POINT_PS=fxc.exe /nologo ..\AMD_ShadowFX.hlsl /T ps_5_0 /O1 /E shadowFiltering /DAMD_SHADOWFX_FILTERING=10 /DAMD_SHADOWFX_TEXTURE_TYPE=2 /DAMD_SHADOWFX_EXECUTION=3
+
+SET ABRV=PS_SF_T2DV_AVG_UNIFORM_TEX_FETCH
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_UNIFORM_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+SET ABRV=PS_SF_T2DV_AVG_CONTACT_TEX_FETCH
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_FIXED_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=0 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_GATHER4_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=0
+
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_NONE_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=0 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_CALC_FROM_DEPTH_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=1 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_7_Data /DAMD_SHADOWFX_FILTER_SIZE=7  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_9_Data /DAMD_SHADOWFX_FILTER_SIZE=9  /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_11_Data /DAMD_SHADOWFX_FILTER_SIZE=11 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_13_Data /DAMD_SHADOWFX_FILTER_SIZE=13 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+%FXC_COMPILE_CONTACT_PS% /Fh ..\inc\%ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15.inc /Vn %ABRV%_PCF_TAP_TYPE_POISSON_NORMAL_OPTION_READ_FROM_SRV_FILTER_SIZE_15_Data /DAMD_SHADOWFX_FILTER_SIZE=15 /DAMD_SHADOWFX_NORMAL_OPTION=2 /DAMD_SHADOWFX_TAP_TYPE=1 /DAMD_SHADOWFX_TEXTURE_FETCH=1
+
+
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_NONE.inc /Vn PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_NONE_Data /DAMD_SHADOWFX_NORMAL_OPTION=0
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH.inc /Vn PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_CALC_FROM_DEPTH_Data /DAMD_SHADOWFX_NORMAL_OPTION=1
+%FXC_COMPILE_POINT_PS% /Fh ..\inc\PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV.inc /Vn PS_SF_T2DV_AVG_POINT_NORMAL_OPTION_READ_FROM_SRV_Data /DAMD_SHADOWFX_NORMAL_OPTION=2
@@ -0,0 +1,10 @@
+REM Regenerates the reduced tap count Poisson tables (8, 12 and 16 taps per filter size)
+REM Build amd_shadowfx\tools\poisson_gen first. Use -eval to compare against the existing tables
+
+SET POISSON_GEN=..\..\..\tools\poisson_gen\bin\AMD_ShadowFX_PoissonGen_Release_2015.exe
+
+FOR %%S IN (7 9 11 13 15) DO (
+  FOR %%T IN (8 12 16) DO (
+    %POISSON_GEN% -taps %%T -filter_size %%S -out ..\AMD_SHADOWFX_FILTER_SIZE_%%S_POISSON_%%T.inc
+  )
+)